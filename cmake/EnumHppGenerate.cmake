@@ -0,0 +1,37 @@
+#
+# enum_hpp_generate(<target> <input>... [OUTPUT_DIRECTORY <directory>])
+#
+# generates <name>.hpp from every <name>.enum input by enum_gen, adds
+# the headers to the target sources and the output directory
+# (${CMAKE_CURRENT_BINARY_DIR}/enum.hpp.generated by default)
+# to the target include directories, enum.hpp::gen is the built
+# or the installed enum_gen
+#
+
+function(enum_hpp_generate TARGET)
+    cmake_parse_arguments(PARSE_ARGV 1 ARG "" "OUTPUT_DIRECTORY" "")
+
+    if(NOT ARG_OUTPUT_DIRECTORY)
+        set(ARG_OUTPUT_DIRECTORY "${CMAKE_CURRENT_BINARY_DIR}/enum.hpp.generated")
+    endif()
+
+    file(MAKE_DIRECTORY "${ARG_OUTPUT_DIRECTORY}")
+
+    foreach(INPUT IN LISTS ARG_UNPARSED_ARGUMENTS)
+        get_filename_component(INPUT "${INPUT}" ABSOLUTE)
+        get_filename_component(NAME "${INPUT}" NAME_WLE)
+        set(OUTPUT "${ARG_OUTPUT_DIRECTORY}/${NAME}.hpp")
+
+        add_custom_command(
+            OUTPUT "${OUTPUT}"
+            COMMAND $<TARGET_FILE:enum.hpp::gen> "${INPUT}" "${OUTPUT}"
+            DEPENDS enum.hpp::gen "${INPUT}"
+            COMMENT "Generating ${NAME}.hpp"
+            VERBATIM)
+
+        target_sources(${TARGET} PRIVATE "${OUTPUT}")
+    endforeach()
+
+    target_include_directories(${TARGET} PUBLIC "${ARG_OUTPUT_DIRECTORY}")
+    target_link_libraries(${TARGET} PUBLIC enum.hpp::enum.hpp)
+endfunction()
@@ -6,7 +6,16 @@
 
 #pragma once
 
+#include "enum_core.hpp"
+#include "enum_string.hpp"
+
+#include <array>
+#include <charconv>
+#include <cstdint>
 #include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
 #include <type_traits>
 #include <utility>
 
@@ -311,6 +320,179 @@ namespace enum_hpp::bitflags
     }
 }
 
+namespace enum_hpp::bitflags::detail
+{
+    // calls `f` with the field name of every set bit from the lowest one,
+    // the name hash with ENUM_HPP_NO_NAMES, returns the set bits without
+    // a field of their own
+    template < typename Enum, typename F >
+    constexpr std::optional<typename bitflags<Enum>::underlying_type> for_each_flag_name(bitflags<Enum> flags, F f) {
+        using underlying_type = typename bitflags<Enum>::underlying_type;
+        using unsigned_type = std::make_unsigned_t<underlying_type>;
+
+        unsigned_type unknown{};
+        for ( auto bits = static_cast<unsigned_type>(flags.as_raw()); bits != 0; ) {
+            const auto bit = static_cast<unsigned_type>(unsigned_type{1} << ::enum_hpp::detail::countr_zero(bits));
+            bits = static_cast<unsigned_type>(bits & ~bit);
+
+            if ( const auto name = traits_t<Enum>::to_string(static_cast<Enum>(bit)) ) {
+                f(*name);
+            } else {
+                unknown = static_cast<unsigned_type>(unknown | bit);
+            }
+        }
+
+        if ( unknown ) {
+            return static_cast<underlying_type>(unknown);
+        }
+        return std::nullopt;
+    }
+
+    inline void append_name(std::string& str, std::string_view name) {
+        str += name;
+    }
+
+    // "#<name hash>" like to_chars
+    inline void append_name(std::string& str, std::uint64_t hash) {
+        std::array<char, ::enum_hpp::detail::name_token_length> token{};
+        ::enum_hpp::detail::write_name(token.data(), token.data() + token.size(), hash);
+        str.append(token.data(), token.size());
+    }
+}
+
+namespace enum_hpp::bitflags
+{
+    //
+    // from_string
+    //
+    // parses "read | write | execute" through the enum traits in one pass,
+    // an empty string is parsed to empty flags
+    //
+
+    template < typename Enum >
+    constexpr std::optional<bitflags<Enum>> from_string(
+        std::string_view str,
+        char separator = '|',
+        std::string_view* bad_token = nullptr) noexcept
+    {
+        const std::array<char, 5> delimiters{{separator, ' ', '\t', '\r', '\n'}};
+
+        str = ::enum_hpp::detail::trim_spaces(str);
+        const char* first = str.data();
+        const char* const last = str.data() + str.size();
+
+        // the separator itself can be a space, it is never skipped
+        const auto skip_spaces = [last, separator](const char* p){
+            while ( p != last && *p != separator && ::enum_hpp::detail::is_space(*p) ) {
+                ++p;
+            }
+            return p;
+        };
+
+        const auto report = [last, separator, bad_token](const char* p){
+            const char* e = p;
+            while ( e != last && *e != separator ) {
+                ++e;
+            }
+            if ( bad_token ) {
+                *bad_token = ::enum_hpp::detail::trim_spaces(
+                    std::string_view(p, static_cast<std::size_t>(e - p)));
+            }
+            return std::optional<bitflags<Enum>>();
+        };
+
+        bitflags<Enum> flags{};
+
+        if ( first == last ) {
+            return flags;
+        }
+
+        for ( ;; ) {
+            const ::enum_hpp::parse_result<Enum> token = traits_t<Enum>::parse_prefix(
+                first, last, std::string_view(delimiters.data(), delimiters.size()));
+
+            if ( !token.value ) {
+                return report(first);
+            }
+
+            flags.set(*token.value);
+
+            const char* next = skip_spaces(token.ptr);
+            if ( next == last ) {
+                return flags;
+            }
+
+            if ( *next != separator ) {
+                return report(first);
+            }
+
+            first = skip_spaces(next + 1);
+        }
+    }
+
+    //
+    // to_string
+    //
+    // prints every set bit by its field name, "read|write" for separator '|',
+    // or by "#<name hash>" with ENUM_HPP_NO_NAMES,
+    // fails if any set bit has no field of its own
+    //
+
+    template < typename Enum >
+    std::optional<std::string> to_string(bitflags<Enum> flags, char separator = '|') {
+        std::string result;
+        const auto unknown = ::enum_hpp::bitflags::detail::for_each_flag_name(flags, [&result, separator](auto name){
+            if ( !result.empty() ) {
+                result += separator;
+            }
+            ::enum_hpp::bitflags::detail::append_name(result, name);
+        });
+        if ( unknown ) {
+            return std::nullopt;
+        }
+        return result;
+    }
+
+    //
+    // to_chars
+    //
+    // writes "read|write" like to_string, set bits without a field of their own
+    // are written last as one "Enum(bits)" item
+    //
+
+    template < typename Enum >
+    constexpr std::size_t max_chars_length() noexcept {
+    #if defined(ENUM_HPP_NO_NAMES)
+        std::size_t length = (::enum_hpp::detail::name_token_length + 1) * traits_t<Enum>::size;
+    #else
+        std::size_t length = ::enum_hpp::detail::total_name_length(traits_t<Enum>::template names<>) + traits_t<Enum>::size;
+    #endif
+        return length + ::enum_hpp::detail::max_unknown_enum_chars<Enum>();
+    }
+
+    template < typename Enum >
+    std::to_chars_result to_chars(char* first, char* last, bitflags<Enum> flags, char separator = '|') noexcept {
+        std::to_chars_result result{first, std::errc{}};
+        const auto unknown = ::enum_hpp::bitflags::detail::for_each_flag_name(flags, [&result, first, last, separator](auto name){
+            if ( result.ec == std::errc{} && result.ptr != first ) {
+                result = ::enum_hpp::detail::write_chars(result.ptr, last, std::string_view(&separator, 1));
+            }
+            if ( result.ec == std::errc{} ) {
+                result = ::enum_hpp::detail::write_name(result.ptr, last, name);
+            }
+        });
+        if ( unknown ) {
+            if ( result.ec == std::errc{} && result.ptr != first ) {
+                result = ::enum_hpp::detail::write_chars(result.ptr, last, std::string_view(&separator, 1));
+            }
+            if ( result.ec == std::errc{} ) {
+                result = ::enum_hpp::detail::write_unknown_enum<Enum>(result.ptr, last, *unknown);
+            }
+        }
+        return result;
+    }
+}
+
 //
 // ENUM_HPP_OPERATORS_DECL
 //
@@ -0,0 +1,212 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/enum.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2019-2023, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#pragma once
+
+//
+// the generic functions of registered traits that do not need names,
+// enough to use declared enumerations as indices and values
+//
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace enum_hpp
+{
+    inline constexpr std::size_t invalid_index = std::size_t(-1);
+}
+
+namespace enum_hpp
+{
+    template < typename Enum >
+    using traits_t = decltype(enum_hpp_adl_find_registered_traits(std::declval<Enum>()));
+
+    template < typename Enum >
+    using underlying_type = typename traits_t<Enum>::underlying_type;
+
+    template < typename Enum >
+    constexpr std::size_t size() noexcept {
+        return traits_t<Enum>::size;
+    }
+
+    template < typename Enum >
+    constexpr const std::array<Enum, size<Enum>()>& values() noexcept {
+        return traits_t<Enum>::values;
+    }
+
+    template < typename Enum >
+    constexpr underlying_type<Enum> min_value() noexcept {
+        return traits_t<Enum>::min_value;
+    }
+
+    template < typename Enum >
+    constexpr underlying_type<Enum> max_value() noexcept {
+        return traits_t<Enum>::max_value;
+    }
+
+    template < typename Enum >
+    constexpr bool is_contiguous() noexcept {
+        return traits_t<Enum>::is_contiguous;
+    }
+
+    template < typename Enum >
+    constexpr bool is_single_bit() noexcept {
+        return traits_t<Enum>::is_single_bit;
+    }
+
+    // the hashes identify the fields, so colliding names fail the build
+    template < typename Enum >
+    constexpr const std::array<std::uint64_t, size<Enum>()>& name_hashes() noexcept {
+        static_assert(traits_t<Enum>::template name_hashes_unique<>, "enum_hpp::name_hashes(): field name hash collision");
+        return traits_t<Enum>::name_hashes;
+    }
+
+    template < typename Enum >
+    constexpr typename traits_t<Enum>::underlying_type to_underlying(Enum e) noexcept {
+        return traits_t<Enum>::to_underlying(e);
+    }
+
+    template < typename Enum >
+    constexpr std::optional<Enum> from_underlying(underlying_type<Enum> value) noexcept {
+        return traits_t<Enum>::from_underlying(value);
+    }
+
+    template < typename Enum >
+    constexpr Enum from_underlying_or_default(underlying_type<Enum> value, Enum def) noexcept {
+        return traits_t<Enum>::from_underlying_or_default(value, def);
+    }
+
+    template < typename Enum >
+    constexpr std::size_t validate(const underlying_type<Enum>* data, std::size_t count) noexcept {
+        return traits_t<Enum>::validate(data, count);
+    }
+
+    template < typename Enum >
+    constexpr std::optional<Enum> from_name_hash(std::uint64_t hash) noexcept {
+        return traits_t<Enum>::from_name_hash(hash);
+    }
+
+    template < typename Enum >
+    constexpr Enum from_name_hash_or_default(std::uint64_t hash, Enum def) noexcept {
+        return traits_t<Enum>::from_name_hash_or_default(hash, def);
+    }
+
+    template < typename Enum >
+    constexpr std::optional<std::size_t> to_index(Enum e) noexcept {
+        return traits_t<Enum>::to_index(e);
+    }
+
+    template < typename Enum >
+    constexpr std::size_t to_index_or_invalid(Enum e) noexcept {
+        return traits_t<Enum>::to_index_or_invalid(e);
+    }
+
+    template < typename Enum >
+    constexpr std::optional<Enum> from_index(std::size_t index) noexcept {
+        return traits_t<Enum>::from_index(index);
+    }
+
+    template < typename Enum >
+    constexpr Enum from_index_or_default(std::size_t index, Enum def) noexcept {
+        return traits_t<Enum>::from_index_or_default(index, def);
+    }
+}
+
+namespace enum_hpp::detail
+{
+    template < typename Enum, typename = void >
+    struct has_traits : std::false_type {};
+
+    template < typename Enum >
+    struct has_traits<Enum, std::void_t<traits_t<Enum>>> : std::true_type {};
+
+    template < typename Enum >
+    inline constexpr bool has_traits_v = has_traits<Enum>::value;
+}
+
+namespace enum_hpp::detail
+{
+    template < typename T >
+    constexpr std::size_t countr_zero(T v) noexcept {
+        static_assert(std::is_unsigned_v<T>);
+    #if defined(__GNUC__) || defined(__clang__)
+        return v != 0
+            ? static_cast<std::size_t>(__builtin_ctzll(static_cast<unsigned long long>(v)))
+            : static_cast<std::size_t>(std::numeric_limits<T>::digits);
+    #else
+        std::size_t n = 0;
+        while ( n < static_cast<std::size_t>(std::numeric_limits<T>::digits) && !(v & 1u) ) {
+            v >>= 1u;
+            ++n;
+        }
+        return n;
+    #endif
+    }
+
+    template < typename T >
+    constexpr bool has_single_bit(T v) noexcept {
+        static_assert(std::is_unsigned_v<T>);
+        return v != 0 && (v & static_cast<T>(v - 1)) == 0;
+    }
+
+    template < typename T >
+    constexpr std::size_t popcount(T v) noexcept {
+        static_assert(std::is_unsigned_v<T>);
+    #if defined(__GNUC__) || defined(__clang__)
+        return static_cast<std::size_t>(__builtin_popcountll(static_cast<unsigned long long>(v)));
+    #else
+        std::size_t n = 0;
+        for ( ; v != 0; v &= static_cast<T>(v - 1) ) {
+            ++n;
+        }
+        return n;
+    #endif
+    }
+}
+
+namespace enum_hpp::detail
+{
+    // one bit per field with an index of its own, a field with the value of
+    // an earlier field has the earlier index from to_index; compares values
+    // only, so it is a constant expression for extern traits too
+    template < typename Enum >
+    constexpr std::array<std::uint64_t, (size<Enum>() + 63) / 64> make_indexed_field_words() noexcept {
+        const std::array<Enum, size<Enum>()>& values = traits_t<Enum>::values;
+        std::array<std::uint64_t, (size<Enum>() + 63) / 64> words{};
+        for ( std::size_t i = 0; i < values.size(); ++i ) {
+            bool indexed = true;
+            for ( std::size_t j = 0; indexed && j < i; ++j ) {
+                indexed = values[j] != values[i];
+            }
+            if ( indexed ) {
+                words[i / 64] |= std::uint64_t{1} << (i % 64);
+            }
+        }
+        return words;
+    }
+
+    template < typename Enum >
+    inline constexpr std::array<std::uint64_t, (size<Enum>() + 63) / 64> indexed_field_words = make_indexed_field_words<Enum>();
+
+    template < typename Enum >
+    constexpr bool is_indexed_field(std::size_t index) noexcept {
+        return ((indexed_field_words<Enum>[index / 64] >> (index % 64)) & 1u) != 0;
+    }
+
+    template < typename Enum >
+    constexpr std::size_t indexed_field_count() noexcept {
+        std::size_t count = 0;
+        for ( const std::uint64_t word : indexed_field_words<Enum> ) {
+            count += popcount(word);
+        }
+        return count;
+    }
+}
@@ -0,0 +1,2211 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/enum.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2019-2023, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#pragma once
+
+//
+// the declaration macros and the compile-time builders of the traits,
+// only needed where enumerations or their traits are declared
+//
+
+#include "enum_core.hpp"
+#include "enum_string.hpp"
+#include "enum_throw.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace enum_hpp::detail
+{
+    // `value` as an expression depending on `Lazy`, an initializer of a variable
+    // template using it is only evaluated when the template is instantiated
+    template < typename Lazy, typename T >
+    constexpr const T& lazy(const T& value) noexcept {
+        return value;
+    }
+
+    template < typename Enum >
+    struct ignore_assign final {
+        Enum value;
+
+        constexpr explicit ignore_assign(Enum value) noexcept
+        : value(value) {}
+
+        template < typename Other >
+        // NOLINTNEXTLINE(readability-named-parameter)
+        constexpr ignore_assign& operator=(const Other&) noexcept {
+            return *this;
+        }
+    };
+
+    constexpr bool is_end_of_name(char ch) noexcept {
+        switch ( ch ) {
+            case ' ':
+            case '=':
+            case '\r':
+            case '\n':
+            case '\t':
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    constexpr std::string_view trim_raw_name(std::string_view raw_name) noexcept {
+        for ( std::size_t i = 0; i < raw_name.size(); ++i ) {
+            if ( is_end_of_name(raw_name[i]) ) {
+                return raw_name.substr(0, i);
+            }
+        }
+        return raw_name;
+    }
+
+    // returns the position after the parenthesis closing the one at `open`
+    constexpr std::size_t find_raw_group_end(std::string_view raw, std::size_t open) noexcept {
+        std::size_t depth = 0;
+        for ( std::size_t i = open; i < raw.size(); ++i ) {
+            if ( raw[i] == '(' ) {
+                ++depth;
+            } else if ( raw[i] == ')' && --depth == 0 ) {
+                return i + 1;
+            }
+        }
+        return raw.size();
+    }
+
+    // "(gray = 5)(grey)" -> "gray = 5", "gray = 5" -> "gray = 5"
+    constexpr std::string_view trim_raw_field(std::string_view raw_field) noexcept {
+        if ( raw_field.empty() || raw_field.front() != '(' ) {
+            return raw_field;
+        }
+        const std::size_t end = find_raw_group_end(raw_field, 0);
+        return trim_spaces(raw_field.substr(1, end - 2));
+    }
+
+    // "(gray = 5)(grey)(gris)" -> "grey", "gris"
+    template < typename F >
+    constexpr void for_each_raw_field_alias(std::string_view raw_field, F f) noexcept {
+        if ( raw_field.empty() || raw_field.front() != '(' ) {
+            return;
+        }
+        std::size_t pos = find_raw_group_end(raw_field, 0);
+        while ( pos < raw_field.size() ) {
+            if ( raw_field[pos] != '(' ) {
+                ++pos;
+                continue;
+            }
+            const std::size_t end = find_raw_group_end(raw_field, pos);
+            f(trim_spaces(raw_field.substr(pos + 1, end - pos - 2)));
+            pos = end;
+        }
+    }
+
+    // calls f with every field of "a, b = (1, 2), c", commas inside
+    // brackets and literals do not separate fields
+    template < typename F >
+    constexpr void for_each_raw_field_in_list(std::string_view list, F f) noexcept {
+        std::size_t depth = 0;
+        std::size_t first = 0;
+        char quote = '\0';
+        for ( std::size_t i = 0; i < list.size(); ++i ) {
+            const char ch = list[i];
+            if ( quote != '\0' ) {
+                if ( ch == '\\' ) {
+                    ++i;
+                } else if ( ch == quote ) {
+                    quote = '\0';
+                }
+            } else if ( ch == '"' || ch == '\'' ) {
+                quote = ch;
+            } else if ( ch == '(' || ch == '[' || ch == '{' ) {
+                ++depth;
+            } else if ( ch == ')' || ch == ']' || ch == '}' ) {
+                --depth;
+            } else if ( ch == ',' && depth == 0 ) {
+                f(trim_spaces(list.substr(first, i - first)));
+                first = i + 1;
+            }
+        }
+        f(trim_spaces(list.substr(first)));
+    }
+
+    constexpr std::size_t count_raw_field_list(std::string_view list) noexcept {
+        std::size_t count = 0;
+        for_each_raw_field_in_list(list, [&count](std::string_view){
+            ++count;
+        });
+        return count;
+    }
+
+    template < std::size_t Size >
+    constexpr std::array<std::string_view, Size> split_raw_field_list(std::string_view list) noexcept {
+        std::array<std::string_view, Size> raw_fields{};
+        std::size_t count = 0;
+        for_each_raw_field_in_list(list, [&raw_fields, &count](std::string_view raw_field){
+            if ( count < Size ) {
+                raw_fields[count] = raw_field;
+            }
+            ++count;
+        });
+        return raw_fields;
+    }
+
+    // a field of the variadic declarations: `b = 3` assigns a value,
+    // the others get the next value when they are passed to field_values
+    template < typename Underlying >
+    struct field_value final {
+        Underlying value{};
+        bool assigned{};
+
+        constexpr field_value() noexcept = default;
+
+        constexpr field_value(const field_value& other) noexcept
+        : value(other.value)
+        , assigned(true) {}
+
+        template < typename T >
+        // NOLINTNEXTLINE(google-explicit-constructor, hicpp-explicit-conversions)
+        constexpr field_value(T other) noexcept
+        : value(static_cast<Underlying>(other))
+        , assigned(true) {}
+
+        // NOLINTNEXTLINE(cert-oop54-cpp)
+        constexpr field_value& operator=(const field_value& other) noexcept {
+            value = other.value;
+            assigned = true;
+            return *this;
+        }
+
+        template < typename T >
+        constexpr field_value& operator=(T other) noexcept {
+            value = static_cast<Underlying>(other);
+            assigned = true;
+            return *this;
+        }
+
+        // NOLINTNEXTLINE(google-explicit-constructor, hicpp-explicit-conversions)
+        constexpr operator Underlying() const noexcept {
+            return value;
+        }
+    };
+
+    // `values, a, b = 3, c` gives the next value to the fields without one
+    template < typename Underlying >
+    struct field_values final {
+        Underlying next{};
+        std::size_t count{};
+
+        constexpr field_values& operator,(field_value<Underlying>& field) noexcept {
+            if ( !field.assigned ) {
+                field.value = next;
+            }
+            next = static_cast<Underlying>(field.value + 1);
+            ++count;
+            return *this;
+        }
+    };
+
+    template < typename Enum, std::size_t Size >
+    constexpr std::array<Enum, Size> to_enum_values(const std::array<std::underlying_type_t<Enum>, Size>& values) noexcept {
+        std::array<Enum, Size> enum_values{};
+        for ( std::size_t i = 0; i < Size; ++i ) {
+            enum_values[i] = static_cast<Enum>(values[i]);
+        }
+        return enum_values;
+    }
+
+    template < std::size_t Size >
+    constexpr std::array<std::string_view, Size> make_field_names(const std::array<std::string_view, Size>& raw_fields) noexcept {
+        std::array<std::string_view, Size> names{};
+        for ( std::size_t i = 0; i < Size; ++i ) {
+            names[i] = trim_raw_name(trim_raw_field(raw_fields[i]));
+        }
+        return names;
+    }
+
+    template < std::size_t Size >
+    constexpr std::size_t count_field_aliases(const std::array<std::string_view, Size>& raw_fields) noexcept {
+        std::size_t count = 0;
+        for ( const std::string_view raw_field : raw_fields ) {
+            for_each_raw_field_alias(raw_field, [&count](std::string_view){
+                ++count;
+            });
+        }
+        return count;
+    }
+
+    template < std::size_t Size >
+    constexpr std::size_t total_alias_length(const std::array<std::string_view, Size>& raw_fields) noexcept {
+        std::size_t length = 0;
+        for ( const std::string_view raw_field : raw_fields ) {
+            for_each_raw_field_alias(raw_field, [&length](std::string_view alias){
+                length += alias.size();
+            });
+        }
+        return length;
+    }
+
+    // field names first, then all aliases in declaration order
+    template < std::size_t AliasCount, std::size_t Size >
+    constexpr std::array<std::string_view, Size + AliasCount> make_lookup_names(
+        const std::array<std::string_view, Size>& names,
+        const std::array<std::string_view, Size>& raw_fields) noexcept
+    {
+        std::array<std::string_view, Size + AliasCount> lookup_names{};
+        std::size_t count = 0;
+        for ( std::size_t i = 0; i < Size; ++i ) {
+            lookup_names[count++] = names[i];
+        }
+        for ( std::size_t i = 0; i < Size; ++i ) {
+            for_each_raw_field_alias(raw_fields[i], [&lookup_names, &count](std::string_view alias){
+                lookup_names[count++] = alias;
+            });
+        }
+        return lookup_names;
+    }
+
+    template < std::size_t AliasCount, typename Enum, std::size_t Size >
+    constexpr std::array<Enum, Size + AliasCount> make_lookup_values(
+        const std::array<Enum, Size>& values,
+        const std::array<std::string_view, Size>& raw_fields) noexcept
+    {
+        std::array<Enum, Size + AliasCount> lookup_values{};
+        std::size_t count = 0;
+        for ( std::size_t i = 0; i < Size; ++i ) {
+            lookup_values[count++] = values[i];
+        }
+        for ( std::size_t i = 0; i < Size; ++i ) {
+            const Enum value = values[i];
+            for_each_raw_field_alias(raw_fields[i], [&lookup_values, &count, value](std::string_view){
+                lookup_values[count++] = value;
+            });
+        }
+        return lookup_values;
+    }
+}
+
+namespace enum_hpp::detail
+{
+    template < std::size_t Size >
+    using compact_index_t = std::conditional_t<(Size < 0xFFu), std::uint8_t,
+        std::conditional_t<(Size < 0xFFFFu), std::uint16_t, std::uint32_t>>;
+
+    constexpr std::size_t ceil_pow2(std::size_t v) noexcept {
+        std::size_t r = 1;
+        while ( r < v ) {
+            r <<= 1u;
+        }
+        return r;
+    }
+
+    // folds only the name, the key is expected to be folded already
+    template < typename Fold >
+    constexpr bool name_equal(std::string_view name, std::string_view key, Fold fold) noexcept {
+        if constexpr ( std::is_same_v<Fold, identity_fold> ) {
+            return name == key;
+        } else {
+            if ( name.size() != key.size() ) {
+                return false;
+            }
+            for ( std::size_t i = 0; i < name.size(); ++i ) {
+                if ( fold(name[i]) != key[i] ) {
+                    return false;
+                }
+            }
+            return true;
+        }
+    }
+
+    template < std::size_t Size >
+    constexpr std::size_t max_name_length(const std::array<std::string_view, Size>& names) noexcept {
+        std::size_t length = 0;
+        for ( const std::string_view name : names ) {
+            length = name.size() > length ? name.size() : length;
+        }
+        return length;
+    }
+
+    // orders names by length first, so names of the same length are adjacent
+    constexpr bool name_less(std::string_view l, std::string_view r) noexcept {
+        return l.size() != r.size()
+            ? l.size() < r.size()
+            : l < r;
+    }
+
+    // three-way `name_less`, folds only the name like `name_equal`
+    template < typename Fold >
+    constexpr int name_compare(std::string_view name, std::string_view key, Fold fold) noexcept {
+        if ( name.size() != key.size() ) {
+            return name.size() < key.size() ? -1 : 1;
+        }
+        for ( std::size_t i = 0; i < name.size(); ++i ) {
+            const auto l = static_cast<unsigned char>(fold(name[i]));
+            const auto r = static_cast<unsigned char>(key[i]);
+            if ( l != r ) {
+                return l < r ? -1 : 1;
+            }
+        }
+        return 0;
+    }
+
+    // bottom-up merge sort, stable and not recursive,
+    // passes merge back and forth between the items and a buffer
+    template < typename T, std::size_t Size, typename Less >
+    constexpr void stable_sort(std::array<T, Size>& items, Less less) noexcept {
+        std::array<T, Size> buffer{};
+        bool in_buffer = false;
+        for ( std::size_t width = 1; width < Size; width *= 2 ) {
+            const std::array<T, Size>& from = in_buffer ? buffer : items;
+            std::array<T, Size>& to = in_buffer ? items : buffer;
+            for ( std::size_t first = 0; first < Size; first += 2 * width ) {
+                const std::size_t middle = first + width < Size ? first + width : Size;
+                const std::size_t last = first + 2 * width < Size ? first + 2 * width : Size;
+                std::size_t l = first;
+                std::size_t r = middle;
+                for ( std::size_t i = first; i < last; ++i ) {
+                    to[i] = r == last || (l < middle && !less(from[r], from[l]))
+                        ? from[l++]
+                        : from[r++];
+                }
+            }
+            in_buffer = !in_buffer;
+        }
+        if ( in_buffer ) {
+            items = buffer;
+        }
+    }
+
+    //
+    // name_pool
+    //
+
+    // every name is followed by '\0', so names can be passed to C APIs
+    template < std::size_t Size, std::size_t Length >
+    struct name_pool final {
+        using offset_type = compact_index_t<Length + Size + 1>;
+
+        std::array<char, Length + Size> chars{};
+        std::array<offset_type, Size + 1> offsets{};
+
+        static constexpr std::size_t size() noexcept {
+            return Size;
+        }
+
+        constexpr std::string_view operator[](std::size_t index) const noexcept {
+            return std::string_view(
+                chars.data() + offsets[index],
+                static_cast<std::size_t>(offsets[index + 1] - offsets[index] - 1));
+        }
+
+    #if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+    // g++ reports strlen of a pointer into the middle of a constexpr pool
+    // as an overread, the names there are terminated
+    #  pragma GCC diagnostic push
+    #  pragma GCC diagnostic ignored "-Wstringop-overread"
+    #endif
+        constexpr const char* c_str(std::size_t index) const noexcept {
+            return chars.data() + offsets[index];
+        }
+    #if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+    #  pragma GCC diagnostic pop
+    #endif
+
+        template < std::size_t Count = Size >
+        constexpr std::array<const char*, Count> c_strs() const noexcept {
+            static_assert(Count <= Size);
+            std::array<const char*, Count> result{};
+            for ( std::size_t i = 0; i < Count; ++i ) {
+                result[i] = c_str(i);
+            }
+            return result;
+        }
+
+        template < std::size_t Count = Size >
+        constexpr std::array<std::string_view, Count> views() const noexcept {
+            static_assert(Count <= Size);
+            std::array<std::string_view, Count> result{};
+            for ( std::size_t i = 0; i < Count; ++i ) {
+                result[i] = (*this)[i];
+            }
+            return result;
+        }
+    };
+
+    template < std::size_t Length, std::size_t Size, typename Fold >
+    constexpr name_pool<Size, Length> make_name_pool(const std::array<std::string_view, Size>& names, Fold fold) noexcept {
+        using pool_type = name_pool<Size, Length>;
+
+        pool_type pool{};
+        std::size_t offset = 0;
+        for ( std::size_t i = 0; i < Size; ++i ) {
+            pool.offsets[i] = static_cast<typename pool_type::offset_type>(offset);
+            for ( const char ch : names[i] ) {
+                pool.chars[offset++] = fold(ch);
+            }
+            pool.chars[offset++] = '\0';
+        }
+        pool.offsets[Size] = static_cast<typename pool_type::offset_type>(offset);
+        return pool;
+    }
+
+    // keys are a std::array of names or a name_pool
+    template < typename Keys, typename Fold >
+    constexpr std::size_t find_name_linear(const Keys& keys, std::string_view name, Fold fold) noexcept {
+        for ( std::size_t i = 0; i < keys.size(); ++i ) {
+            if ( name_equal(name, keys[i], fold) ) {
+                return i;
+            }
+        }
+        return invalid_index;
+    }
+
+    //
+    // linear_search
+    //
+
+    template < std::size_t Size >
+    struct linear_search final {
+        template < typename Keys, typename Fold = identity_fold >
+        constexpr std::size_t find(const Keys& keys, std::string_view name, Fold fold = Fold{}) const noexcept {
+            return find_name_linear(keys, name, fold);
+        }
+    };
+
+    //
+    // sorted_search
+    //
+
+    template < std::size_t Size >
+    struct sorted_search final {
+        using index_type = compact_index_t<Size>;
+
+        std::size_t count{};
+        std::array<index_type, Size> sorted{};
+
+        template < typename Keys, typename Fold = identity_fold >
+        constexpr std::size_t find(const Keys& keys, std::string_view name, Fold fold = Fold{}) const noexcept {
+            std::size_t first = 0;
+            std::size_t last = count;
+            while ( first < last ) {
+                const std::size_t middle = first + (last - first) / 2;
+                const int cmp = name_compare(name, keys[sorted[middle]], fold);
+                if ( cmp == 0 ) {
+                    return sorted[middle];
+                }
+                if ( cmp < 0 ) {
+                    last = middle;
+                } else {
+                    first = middle + 1;
+                }
+            }
+            return invalid_index;
+        }
+    };
+
+    template < std::size_t Size >
+    constexpr sorted_search<Size> make_sorted_search(const std::array<std::string_view, Size>& keys) noexcept {
+        using index_type = typename sorted_search<Size>::index_type;
+
+        std::array<std::size_t, Size> sorted{};
+        for ( std::size_t i = 0; i < Size; ++i ) {
+            sorted[i] = i;
+        }
+
+        stable_sort(sorted, [&keys](std::size_t l, std::size_t r){
+            return name_less(keys[l], keys[r]);
+        });
+
+        // the sort is stable, so the first declared name wins
+        sorted_search<Size> search{};
+        for ( std::size_t i = 0; i < Size; ++i ) {
+            if ( search.count == 0 || keys[search.sorted[search.count - 1]] != keys[sorted[i]] ) {
+                search.sorted[search.count++] = static_cast<index_type>(sorted[i]);
+            }
+        }
+        return search;
+    }
+
+    // murmur3 finalizer
+    constexpr std::uint64_t mix_hash(std::uint64_t h, std::uint64_t seed) noexcept {
+        h ^= seed * 0x9e3779b97f4a7c15u;
+        h ^= h >> 33u;
+        h *= 0xff51afd7ed558ccdu;
+        h ^= h >> 33u;
+        h *= 0xc4ceb9fe1a85ec53u;
+        h ^= h >> 33u;
+        return h;
+    }
+
+    //
+    // perfect_hash
+    //
+    // Two-level "hash and displace" table: the first level maps a name to a bucket,
+    // the bucket stores either a direct slot or a seed for the second level hash.
+    // A lookup is one name hash, one probe and one compare.
+    //
+
+    template < std::size_t Size >
+    struct perfect_hash final {
+        using index_type = compact_index_t<Size>;
+
+        static constexpr std::size_t table_size = ceil_pow2(Size);
+        static constexpr std::size_t table_mask = table_size - 1;
+        static constexpr index_type empty_slot = static_cast<index_type>(~index_type{0});
+        static constexpr std::uint32_t direct_slot_flag = 0x80000000u;
+
+        bool valid{};
+        std::uint64_t seed{};
+        std::array<std::uint32_t, table_size> displacements{};
+        std::array<index_type, table_size> slots{};
+
+        constexpr std::size_t bucket_of(std::uint64_t h) const noexcept {
+            return static_cast<std::size_t>(mix_hash(h, seed) & table_mask);
+        }
+
+        static constexpr std::size_t slot_of(std::uint64_t h, std::uint32_t displacement) noexcept {
+            return static_cast<std::size_t>(mix_hash(h, displacement) & table_mask);
+        }
+
+        template < typename Keys, typename Fold = identity_fold >
+        constexpr std::size_t find(const Keys& keys, std::string_view name, Fold fold = Fold{}) const noexcept {
+            if ( !valid ) {
+                return find_name_linear(keys, name, fold);
+            }
+            return find_hashed(keys, name, hash_name(name, fold), fold);
+        }
+
+        template < typename Keys, typename Fold = identity_fold >
+        constexpr std::size_t find_hashed(const Keys& keys, std::string_view name, std::uint64_t h, Fold fold = Fold{}) const noexcept {
+            if ( !valid ) {
+                return find_name_linear(keys, name, fold);
+            }
+            const std::uint32_t d = displacements[bucket_of(h)];
+            const std::size_t slot = (d & direct_slot_flag)
+                ? static_cast<std::size_t>(d & ~direct_slot_flag)
+                : slot_of(h, d);
+            const index_type index = slots[slot];
+            return index != empty_slot && name_equal(name, keys[index], fold)
+                ? static_cast<std::size_t>(index)
+                : invalid_index;
+        }
+    };
+
+    template < std::size_t Size >
+    constexpr bool build_perfect_hash(
+        perfect_hash<Size>& table,
+        const std::array<std::string_view, Size>& keys,
+        const std::array<std::uint64_t, Size>& hashes) noexcept
+    {
+        using table_type = perfect_hash<Size>;
+        using index_type = typename table_type::index_type;
+        constexpr std::size_t table_size = table_type::table_size;
+        constexpr std::uint32_t max_displacement = 1u << 16u;
+
+        std::array<std::size_t, table_size + 1> bucket_begins{};
+        std::array<std::size_t, table_size> bucket_sizes{};
+        std::array<std::size_t, Size> bucket_keys{};
+        std::array<bool, table_size> used_slots{};
+
+        for ( std::size_t i = 0; i < Size; ++i ) {
+            ++bucket_begins[table.bucket_of(hashes[i]) + 1];
+        }
+
+        for ( std::size_t b = 0; b < table_size; ++b ) {
+            bucket_begins[b + 1] += bucket_begins[b];
+        }
+
+        std::size_t max_bucket_size = 0;
+        for ( std::size_t i = 0; i < Size; ++i ) {
+            const std::size_t b = table.bucket_of(hashes[i]);
+            bool duplicate = false;
+            for ( std::size_t k = 0; k < bucket_sizes[b]; ++k ) {
+                const std::size_t j = bucket_keys[bucket_begins[b] + k];
+                if ( hashes[j] == hashes[i] ) {
+                    if ( keys[j] != keys[i] ) {
+                        // full hash collision, no seed can separate these names
+                        return false;
+                    }
+                    // the first declared name wins
+                    duplicate = true;
+                }
+            }
+            if ( !duplicate ) {
+                bucket_keys[bucket_begins[b] + bucket_sizes[b]++] = i;
+                max_bucket_size = bucket_sizes[b] > max_bucket_size ? bucket_sizes[b] : max_bucket_size;
+            }
+        }
+
+        for ( index_type& slot : table.slots ) {
+            slot = table_type::empty_slot;
+        }
+
+        for ( std::size_t bucket_size = max_bucket_size; bucket_size > 1; --bucket_size ) {
+            for ( std::size_t b = 0; b < table_size; ++b ) {
+                if ( bucket_sizes[b] != bucket_size ) {
+                    continue;
+                }
+
+                const std::size_t first = bucket_begins[b];
+                const std::size_t last = first + bucket_size;
+
+                std::uint32_t d = 1;
+                for ( ; d < max_displacement; ++d ) {
+                    bool fits = true;
+                    for ( std::size_t k = first; fits && k < last; ++k ) {
+                        const std::size_t slot = table_type::slot_of(hashes[bucket_keys[k]], d);
+                        fits = !used_slots[slot];
+                        for ( std::size_t l = first; fits && l < k; ++l ) {
+                            fits = slot != table_type::slot_of(hashes[bucket_keys[l]], d);
+                        }
+                    }
+                    if ( fits ) {
+                        break;
+                    }
+                }
+
+                if ( d == max_displacement ) {
+                    return false;
+                }
+
+                table.displacements[b] = d;
+                for ( std::size_t k = first; k < last; ++k ) {
+                    const std::size_t slot = table_type::slot_of(hashes[bucket_keys[k]], d);
+                    used_slots[slot] = true;
+                    table.slots[slot] = static_cast<index_type>(bucket_keys[k]);
+                }
+            }
+        }
+
+        std::size_t free_slot = 0;
+        for ( std::size_t b = 0; b < table_size; ++b ) {
+            if ( bucket_sizes[b] != 1 ) {
+                continue;
+            }
+            while ( used_slots[free_slot] ) {
+                ++free_slot;
+            }
+            used_slots[free_slot] = true;
+            table.displacements[b] = table_type::direct_slot_flag | static_cast<std::uint32_t>(free_slot);
+            table.slots[free_slot] = static_cast<index_type>(bucket_keys[bucket_begins[b]]);
+        }
+
+        return true;
+    }
+
+    template < std::size_t Size >
+    constexpr perfect_hash<Size> make_perfect_hash(const std::array<std::string_view, Size>& keys) noexcept {
+        std::array<std::uint64_t, Size> hashes{};
+        for ( std::size_t i = 0; i < Size; ++i ) {
+            hashes[i] = hash_name(keys[i]);
+        }
+
+        for ( std::uint64_t seed = 1; seed <= 16; ++seed ) {
+            perfect_hash<Size> table{};
+            table.seed = seed;
+            if ( build_perfect_hash(table, keys, hashes) ) {
+                table.valid = true;
+                return table;
+            }
+        }
+
+        // falls back to the linear search
+        return perfect_hash<Size>{};
+    }
+
+    //
+    // hash_table
+    //
+    // Open addressing by name hash with linear probing, the table generated
+    // traits are written with. Twice as many slots as names keep the probe
+    // chains short, a lookup is one hash and a compare per probe.
+    //
+
+    template < std::size_t Size >
+    struct hash_table final {
+        using index_type = compact_index_t<Size + 1>;
+
+        static constexpr std::size_t table_size = ceil_pow2(Size * 2);
+        static constexpr std::size_t table_mask = table_size - 1;
+
+        // a key index + 1 per slot, 0 for empty slots
+        std::array<index_type, table_size> slots{};
+
+        template < typename Keys, typename Fold = identity_fold >
+        constexpr std::size_t find(const Keys& keys, std::string_view name, Fold fold = Fold{}) const noexcept {
+            return find_hashed(keys, name, hash_name(name, fold), fold);
+        }
+
+        template < typename Keys, typename Fold = identity_fold >
+        constexpr std::size_t find_hashed(const Keys& keys, std::string_view name, std::uint64_t h, Fold fold = Fold{}) const noexcept {
+            for ( std::size_t slot = static_cast<std::size_t>(h & table_mask); slots[slot] != 0; slot = (slot + 1) & table_mask ) {
+                if ( const std::size_t index = slots[slot] - 1u; name_equal(name, keys[index], fold) ) {
+                    return index;
+                }
+            }
+            return invalid_index;
+        }
+    };
+
+    template < std::size_t Size >
+    constexpr hash_table<Size> make_hash_table(const std::array<std::string_view, Size>& keys) noexcept {
+        using table_type = hash_table<Size>;
+        using index_type = typename table_type::index_type;
+
+        table_type table{};
+        for ( std::size_t i = 0; i < Size; ++i ) {
+            const std::uint64_t h = hash_name(keys[i]);
+            // the first declared name wins
+            if ( table.find_hashed(keys, keys[i], h) != invalid_index ) {
+                continue;
+            }
+            std::size_t slot = static_cast<std::size_t>(h & table_type::table_mask);
+            while ( table.slots[slot] != 0 ) {
+                slot = (slot + 1) & table_type::table_mask;
+            }
+            table.slots[slot] = static_cast<index_type>(i + 1);
+        }
+        return table;
+    }
+
+    // the indices probed by a name hash, the batch and prefix searches
+    // compute the hashes for them ahead of the probes
+    template < typename Index >
+    inline constexpr bool is_hashed_index_v = false;
+
+    template < std::size_t Size >
+    inline constexpr bool is_hashed_index_v<perfect_hash<Size>> = true;
+
+    template < std::size_t Size >
+    inline constexpr bool is_hashed_index_v<hash_table<Size>> = true;
+
+    // hashes a block of names before probing the table, so the independent
+    // hash chains of neighbouring names can overlap in the pipeline
+    template < typename Index, typename Keys, typename Enum, std::size_t Size >
+    constexpr std::size_t find_names_batch(
+        const Index& index,
+        const Keys& keys,
+        const std::array<Enum, Size>& values,
+        const std::string_view* strings,
+        std::size_t count,
+        Enum* out,
+        bool* found) noexcept
+    {
+        constexpr std::size_t block_size = is_hashed_index_v<Index> ? 8 : 1;
+
+        std::size_t misses = 0;
+        for ( std::size_t first = 0; first < count; first += block_size ) {
+            const std::size_t last = first + block_size < count ? first + block_size : count;
+
+            [[maybe_unused]] std::array<std::uint64_t, block_size> hashes{};
+            if constexpr ( is_hashed_index_v<Index> ) {
+                for ( std::size_t i = first; i < last; ++i ) {
+                    hashes[i - first] = hash_name(strings[i]);
+                }
+            }
+
+            for ( std::size_t i = first; i < last; ++i ) {
+                std::size_t k = invalid_index;
+                if constexpr ( is_hashed_index_v<Index> ) {
+                    k = index.find_hashed(keys, strings[i], hashes[i - first]);
+                } else {
+                    k = index.find(keys, strings[i]);
+                }
+                if ( k != invalid_index ) {
+                    out[i] = values[k];
+                } else {
+                    ++misses;
+                }
+                if ( found ) {
+                    found[i] = k != invalid_index;
+                }
+            }
+        }
+        return misses;
+    }
+
+    // hashes the input while scanning it, so the name is matched in one pass;
+    // returns the key index and the length of the longest matched name
+    template < std::size_t MaxLength, typename Index, typename Keys >
+    constexpr std::pair<std::size_t, std::size_t> find_name_prefix(
+        const Index& index,
+        const Keys& keys,
+        std::string_view input,
+        std::string_view delimiters) noexcept
+    {
+        [[maybe_unused]] std::array<std::uint64_t, is_hashed_index_v<Index> ? MaxLength + 1 : 1> hashes{};
+        hashes[0] = hash_name_basis;
+
+        const std::size_t max_length = input.size() < MaxLength ? input.size() : MaxLength;
+
+        std::size_t length = 0;
+        while ( length < max_length && delimiters.find(input[length]) == std::string_view::npos ) {
+            if constexpr ( is_hashed_index_v<Index> ) {
+                hashes[length + 1] = hash_name_step(hashes[length], input[length]);
+            }
+            ++length;
+        }
+
+        const auto find = [&index, &keys, &hashes](std::string_view name) noexcept {
+            if constexpr ( is_hashed_index_v<Index> ) {
+                return index.find_hashed(keys, name, hashes[name.size()]);
+            } else {
+                return index.find(keys, name);
+            }
+        };
+
+        if ( !delimiters.empty() ) {
+            // only the whole token can match
+            if ( length < input.size() && delimiters.find(input[length]) == std::string_view::npos ) {
+                return {invalid_index, 0};
+            }
+            const std::size_t k = find(input.substr(0, length));
+            return {k, k != invalid_index ? length : 0};
+        }
+
+        for ( ; length > 0; --length ) {
+            const std::size_t k = find(input.substr(0, length));
+            if ( k != invalid_index ) {
+                return {k, length};
+            }
+        }
+
+        return {invalid_index, 0};
+    }
+
+    //
+    // name_hash_index
+    //
+
+    template < std::size_t Size >
+    struct name_hash_index final {
+        using index_type = compact_index_t<Size>;
+
+        std::array<std::uint64_t, Size> hashes{};
+        std::array<index_type, Size> indices{};
+
+        constexpr bool unique() const noexcept {
+            for ( std::size_t i = 1; i < Size; ++i ) {
+                if ( hashes[i - 1] == hashes[i] ) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        // branchless lower bound
+        constexpr std::size_t find(std::uint64_t hash) const noexcept {
+            if constexpr ( Size == 0 ) {
+                (void)hash;
+                return invalid_index;
+            } else {
+                std::size_t first = 0;
+                for ( std::size_t length = Size; length > 1; ) {
+                    const std::size_t half = length / 2;
+                    first += hashes[first + half - 1] < hash ? half : 0;
+                    length -= half;
+                }
+                return hashes[first] == hash
+                    ? static_cast<std::size_t>(indices[first])
+                    : invalid_index;
+            }
+        }
+    };
+
+    template < std::size_t Size >
+    constexpr std::array<std::uint64_t, Size> make_name_hashes(const std::array<std::string_view, Size>& names) noexcept {
+        std::array<std::uint64_t, Size> hashes{};
+        for ( std::size_t i = 0; i < Size; ++i ) {
+            hashes[i] = hash_name(names[i]);
+        }
+        return hashes;
+    }
+
+    template < std::size_t Size >
+    constexpr name_hash_index<Size> make_name_hash_index(const std::array<std::uint64_t, Size>& hashes) noexcept {
+        using index_type = typename name_hash_index<Size>::index_type;
+
+        std::array<std::size_t, Size> sorted{};
+        for ( std::size_t i = 0; i < Size; ++i ) {
+            sorted[i] = i;
+        }
+
+        stable_sort(sorted, [&hashes](std::size_t l, std::size_t r){
+            return hashes[l] < hashes[r];
+        });
+
+        name_hash_index<Size> index{};
+        for ( std::size_t i = 0; i < Size; ++i ) {
+            index.hashes[i] = hashes[sorted[i]];
+            index.indices[i] = static_cast<index_type>(sorted[i]);
+        }
+        return index;
+    }
+
+    //
+    // value_index
+    //
+    // Maps a value to the index of its first field: a direct table when the values
+    // are dense, a bit position table when every value is a single bit, and an
+    // Eytzinger-ordered search otherwise.
+    //
+
+    template < typename Enum, std::size_t Size >
+    constexpr std::underlying_type_t<Enum> min_enum_value(const std::array<Enum, Size>& values) noexcept {
+        using underlying_type = std::underlying_type_t<Enum>;
+        underlying_type result = Size > 0 ? static_cast<underlying_type>(values[0]) : underlying_type{};
+        for ( const Enum value : values ) {
+            result = static_cast<underlying_type>(value) < result ? static_cast<underlying_type>(value) : result;
+        }
+        return result;
+    }
+
+    template < typename Enum, std::size_t Size >
+    constexpr std::underlying_type_t<Enum> max_enum_value(const std::array<Enum, Size>& values) noexcept {
+        using underlying_type = std::underlying_type_t<Enum>;
+        underlying_type result = Size > 0 ? static_cast<underlying_type>(values[0]) : underlying_type{};
+        for ( const Enum value : values ) {
+            result = static_cast<underlying_type>(value) > result ? static_cast<underlying_type>(value) : result;
+        }
+        return result;
+    }
+
+    template < typename Enum >
+    constexpr std::make_unsigned_t<std::underlying_type_t<Enum>> enum_value_offset(
+        std::underlying_type_t<Enum> value,
+        std::underlying_type_t<Enum> min) noexcept
+    {
+        using unsigned_type = std::make_unsigned_t<std::underlying_type_t<Enum>>;
+        return static_cast<unsigned_type>(static_cast<unsigned_type>(value) - static_cast<unsigned_type>(min));
+    }
+
+    // returns zero when the values are too sparse for a direct table
+    template < typename Enum, std::size_t Size >
+    constexpr std::size_t dense_value_span(const std::array<Enum, Size>& values) noexcept {
+        constexpr std::size_t max_span_factor = 4;
+        if constexpr ( Size == 0 ) {
+            (void)values;
+            return 0;
+        } else {
+            const std::uint64_t last = enum_value_offset<Enum>(max_enum_value(values), min_enum_value(values));
+            return last < Size * max_span_factor
+                ? static_cast<std::size_t>(last + 1)
+                : 0;
+        }
+    }
+
+    // every value in [min, max] has a field
+    template < typename Enum, std::size_t Size >
+    constexpr bool is_contiguous_values(const std::array<Enum, Size>& values) noexcept {
+        if constexpr ( Size == 0 ) {
+            (void)values;
+            return false;
+        } else {
+            const auto min = min_enum_value(values);
+            const std::uint64_t last = enum_value_offset<Enum>(max_enum_value(values), min);
+            if ( last >= Size ) {
+                return false;
+            }
+            std::array<bool, Size> seen{};
+            std::size_t count = 0;
+            for ( const Enum value : values ) {
+                const std::size_t offset = enum_value_offset<Enum>(static_cast<std::underlying_type_t<Enum>>(value), min);
+                count += seen[offset] ? 0 : 1;
+                seen[offset] = true;
+            }
+            return count == static_cast<std::size_t>(last + 1);
+        }
+    }
+
+    template < typename Enum, std::size_t Size, std::size_t Span >
+    struct dense_value_index final {
+        using underlying_type = std::underlying_type_t<Enum>;
+        using index_type = compact_index_t<Size>;
+
+        static constexpr index_type empty_slot = static_cast<index_type>(~index_type{0});
+
+        underlying_type min{};
+        std::array<index_type, Span> indices{};
+
+        constexpr bool contiguous() const noexcept {
+            for ( const index_type index : indices ) {
+                if ( index == empty_slot ) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        constexpr std::size_t find(Enum e) const noexcept {
+            const auto offset = enum_value_offset<Enum>(static_cast<underlying_type>(e), min);
+            if ( offset >= Span ) {
+                return invalid_index;
+            }
+            const index_type index = indices[offset];
+            return index != empty_slot
+                ? static_cast<std::size_t>(index)
+                : invalid_index;
+        }
+    };
+
+    template < typename Enum, std::size_t Size >
+    struct sparse_value_index final {
+        using underlying_type = std::underlying_type_t<Enum>;
+        using index_type = compact_index_t<Size>;
+
+        // 1-based Eytzinger layout of the distinct values
+        std::size_t count{};
+        std::array<underlying_type, Size + 1> keys{};
+        std::array<index_type, Size + 1> indices{};
+
+        static constexpr bool contiguous() noexcept {
+            return false;
+        }
+
+        constexpr std::size_t find(Enum e) const noexcept {
+            const auto value = static_cast<underlying_type>(e);
+            std::size_t k = 1;
+            while ( k <= count ) {
+                k = 2 * k + static_cast<std::size_t>(keys[k] < value);
+            }
+            // drops the trailing right turns and the last left turn
+            while ( k & 1u ) {
+                k >>= 1u;
+            }
+            k >>= 1u;
+            return k != 0 && keys[k] == value
+                ? static_cast<std::size_t>(indices[k])
+                : invalid_index;
+        }
+    };
+
+    template < typename Enum, std::size_t Size >
+    constexpr void fill_sparse_value_index(
+        sparse_value_index<Enum, Size>& index,
+        const std::array<Enum, Size>& values,
+        const std::array<std::size_t, Size>& sorted,
+        std::size_t& next,
+        std::size_t k) noexcept
+    {
+        using index_type = typename sparse_value_index<Enum, Size>::index_type;
+        using underlying_type = typename sparse_value_index<Enum, Size>::underlying_type;
+
+        if ( k > index.count ) {
+            return;
+        }
+        fill_sparse_value_index(index, values, sorted, next, 2 * k);
+        index.keys[k] = static_cast<underlying_type>(values[sorted[next]]);
+        index.indices[k] = static_cast<index_type>(sorted[next]);
+        ++next;
+        fill_sparse_value_index(index, values, sorted, next, 2 * k + 1);
+    }
+
+    // every value is a distinct single bit, one value may be zero
+    template < typename Enum, std::size_t Size >
+    constexpr bool is_single_bit_values(const std::array<Enum, Size>& values) noexcept {
+        using unsigned_type = std::make_unsigned_t<std::underlying_type_t<Enum>>;
+        unsigned_type seen{};
+        bool seen_zero = false;
+        for ( const Enum value : values ) {
+            const auto bits = static_cast<unsigned_type>(value);
+            if ( bits == 0 ) {
+                if ( seen_zero ) {
+                    return false;
+                }
+                seen_zero = true;
+            } else if ( !has_single_bit(bits) || (seen & bits) ) {
+                return false;
+            } else {
+                seen = static_cast<unsigned_type>(seen | bits);
+            }
+        }
+        return Size > 0;
+    }
+
+    template < typename Enum, std::size_t Size >
+    struct flag_value_index final {
+        using unsigned_type = std::make_unsigned_t<std::underlying_type_t<Enum>>;
+        using index_type = compact_index_t<Size>;
+
+        static constexpr std::size_t bit_count = std::numeric_limits<unsigned_type>::digits;
+        static constexpr index_type empty_slot = static_cast<index_type>(~index_type{0});
+
+        index_type zero{empty_slot};
+        std::array<index_type, bit_count> bits{};
+
+        static constexpr bool contiguous() noexcept {
+            return false;
+        }
+
+        constexpr std::size_t find(Enum e) const noexcept {
+            const auto value = static_cast<unsigned_type>(e);
+            const index_type index = value == 0
+                ? zero
+                : has_single_bit(value) ? bits[countr_zero(value)] : empty_slot;
+            return index != empty_slot
+                ? static_cast<std::size_t>(index)
+                : invalid_index;
+        }
+    };
+
+    // a direct table for dense values, a bit position table for single-bit values,
+    // a branchless search otherwise
+    template < std::size_t Span, bool SingleBit, typename Enum, std::size_t Size >
+    constexpr auto make_value_index(const std::array<Enum, Size>& values) noexcept {
+        if constexpr ( Span == 0 && SingleBit ) {
+            using index_type = flag_value_index<Enum, Size>;
+            using unsigned_type = typename index_type::unsigned_type;
+
+            index_type index{};
+            for ( auto& slot : index.bits ) {
+                slot = index_type::empty_slot;
+            }
+            for ( std::size_t i = 0; i < Size; ++i ) {
+                const auto bits = static_cast<unsigned_type>(values[i]);
+                auto& slot = bits == 0 ? index.zero : index.bits[countr_zero(bits)];
+                slot = static_cast<typename index_type::index_type>(i);
+            }
+            return index;
+        } else if constexpr ( Span > 0 ) {
+            using index_type = dense_value_index<Enum, Size, Span>;
+
+            index_type index{};
+            index.min = min_enum_value(values);
+            for ( auto& slot : index.indices ) {
+                slot = index_type::empty_slot;
+            }
+            // the first declared field wins
+            for ( std::size_t i = Size; i > 0; --i ) {
+                const auto offset = enum_value_offset<Enum>(static_cast<std::underlying_type_t<Enum>>(values[i - 1]), index.min);
+                index.indices[offset] = static_cast<typename index_type::index_type>(i - 1);
+            }
+            return index;
+        } else {
+            using underlying_type = std::underlying_type_t<Enum>;
+
+            std::array<std::size_t, Size> sorted{};
+            for ( std::size_t i = 0; i < Size; ++i ) {
+                sorted[i] = i;
+            }
+
+            stable_sort(sorted, [&values](std::size_t l, std::size_t r){
+                return static_cast<underlying_type>(values[l]) < static_cast<underlying_type>(values[r]);
+            });
+
+            // the sort is stable, so the first declared field wins
+            std::size_t unique = 0;
+            for ( std::size_t i = 0; i < Size; ++i ) {
+                if ( unique == 0 || values[sorted[unique - 1]] != values[sorted[i]] ) {
+                    sorted[unique++] = sorted[i];
+                }
+            }
+
+            sparse_value_index<Enum, Size> index{};
+            index.count = unique;
+
+            std::size_t next = 0;
+            fill_sparse_value_index(index, values, sorted, next, 1);
+            return index;
+        }
+    }
+
+    //
+    // value_bitmap
+    //
+    // One bit per value in [min, min + Words * 64), tested without branches,
+    // so a batch of values can be checked block by block.
+    //
+
+    // returns zero when the values are too sparse for a bitmap
+    template < typename Enum, std::size_t Size >
+    constexpr std::size_t value_bitmap_words(const std::array<Enum, Size>& values) noexcept {
+        constexpr std::size_t max_bits_per_value = 64;
+        if constexpr ( Size == 0 ) {
+            (void)values;
+            return 0;
+        } else {
+            const std::uint64_t last = enum_value_offset<Enum>(max_enum_value(values), min_enum_value(values));
+            return last < Size * max_bits_per_value
+                ? static_cast<std::size_t>(last / 64 + 1)
+                : 0;
+        }
+    }
+
+    template < typename Enum, std::size_t Words >
+    struct value_bitmap final {
+        using underlying_type = std::underlying_type_t<Enum>;
+
+        static constexpr std::size_t bit_count = Words * 64;
+
+        underlying_type min{};
+        std::array<std::uint64_t, Words> words{};
+
+        constexpr bool contains(underlying_type value) const noexcept {
+            const std::size_t offset = enum_value_offset<Enum>(value, min);
+            const bool in_range = offset < bit_count;
+            const std::size_t word = in_range ? offset / 64 : 0;
+            return in_range & static_cast<bool>((words[word] >> (offset % 64)) & 1u);
+        }
+    };
+
+    template < std::size_t Words, typename Enum, std::size_t Size >
+    constexpr value_bitmap<Enum, Words> make_value_bitmap(const std::array<Enum, Size>& values) noexcept {
+        value_bitmap<Enum, Words> bitmap{};
+        if constexpr ( Words > 0 ) {
+            bitmap.min = min_enum_value(values);
+            for ( const Enum value : values ) {
+                const std::size_t offset = enum_value_offset<Enum>(static_cast<std::underlying_type_t<Enum>>(value), bitmap.min);
+                bitmap.words[offset / 64] |= std::uint64_t{1} << (offset % 64);
+            }
+        }
+        return bitmap;
+    }
+
+    // returns the position of the first value without a field
+    template < typename Enum, std::size_t Words, typename ValueIndex >
+    constexpr std::size_t find_invalid_value(
+        const value_bitmap<Enum, Words>& bitmap,
+        const ValueIndex& index,
+        const std::underlying_type_t<Enum>* values,
+        std::size_t count) noexcept
+    {
+        if constexpr ( Words > 0 ) {
+            constexpr std::size_t block_size = 16;
+
+            // no early exit inside a block, the checks can be vectorized
+            std::size_t first = 0;
+            for ( ; first + block_size <= count; first += block_size ) {
+                bool valid = true;
+                for ( std::size_t i = first; i < first + block_size; ++i ) {
+                    valid &= bitmap.contains(values[i]);
+                }
+                if ( !valid ) {
+                    break;
+                }
+            }
+
+            for ( ; first < count; ++first ) {
+                if ( !bitmap.contains(values[first]) ) {
+                    return first;
+                }
+            }
+        } else {
+            (void)bitmap;
+            for ( std::size_t i = 0; i < count; ++i ) {
+                if ( index.find(static_cast<Enum>(values[i])) == invalid_index ) {
+                    return i;
+                }
+            }
+        }
+        return invalid_index;
+    }
+
+    //
+    // name_trie
+    //
+    // Dispatches on the name length first, then walks a crit-bit tree over the names
+    // of that length testing only the discriminating bits, and ends in a single compare.
+    //
+
+    template < std::size_t Size, std::size_t MaxLength >
+    struct name_trie final {
+        using ref_type = compact_index_t<Size * 2>;
+        using byte_type = compact_index_t<MaxLength>;
+
+        // refs below Size are leaves (key indices), others are internal nodes
+        static constexpr ref_type empty_ref = static_cast<ref_type>(~ref_type{0});
+
+        struct node final {
+            byte_type byte{};
+            std::uint8_t mask{};
+            ref_type left{};
+            ref_type right{};
+        };
+
+        std::array<ref_type, MaxLength + 1> roots{};
+        std::array<node, Size> nodes{};
+
+        template < typename Keys, typename Fold = identity_fold >
+        constexpr std::size_t find(const Keys& keys, std::string_view name, Fold fold = Fold{}) const noexcept {
+            if ( name.size() > MaxLength ) {
+                return invalid_index;
+            }
+            std::size_t ref = roots[name.size()];
+            if ( ref == empty_ref ) {
+                return invalid_index;
+            }
+            while ( ref >= Size ) {
+                const node& n = nodes[ref - Size];
+                ref = (static_cast<unsigned char>(fold(name[n.byte])) & n.mask) ? n.right : n.left;
+            }
+            return name_equal(name, keys[ref], fold) ? ref : invalid_index;
+        }
+    };
+
+    template < std::size_t Size, std::size_t MaxLength >
+    constexpr std::size_t build_name_trie_node(
+        name_trie<Size, MaxLength>& trie,
+        std::size_t& node_count,
+        const std::array<std::string_view, Size>& keys,
+        const std::array<std::size_t, Size>& sorted,
+        std::size_t first,
+        std::size_t last) noexcept
+    {
+        using trie_type = name_trie<Size, MaxLength>;
+
+        if ( last - first == 1 ) {
+            return sorted[first];
+        }
+
+        // names in [first, last) are sorted, have the same length and are unique,
+        // so the first differing bit of the outermost names splits the whole range
+        const std::string_view l = keys[sorted[first]];
+        const std::string_view r = keys[sorted[last - 1]];
+
+        std::size_t byte = 0;
+        while ( l[byte] == r[byte] ) {
+            ++byte;
+        }
+
+        const unsigned diff = static_cast<unsigned char>(l[byte]) ^ static_cast<unsigned char>(r[byte]);
+        unsigned mask = 0x80u;
+        while ( !(diff & mask) ) {
+            mask >>= 1u;
+        }
+
+        std::size_t middle = first + 1;
+        while ( !(static_cast<unsigned char>(keys[sorted[middle]][byte]) & mask) ) {
+            ++middle;
+        }
+
+        const std::size_t node = node_count++;
+        const std::size_t left = build_name_trie_node(trie, node_count, keys, sorted, first, middle);
+        const std::size_t right = build_name_trie_node(trie, node_count, keys, sorted, middle, last);
+
+        trie.nodes[node].byte = static_cast<typename trie_type::byte_type>(byte);
+        trie.nodes[node].mask = static_cast<std::uint8_t>(mask);
+        trie.nodes[node].left = static_cast<typename trie_type::ref_type>(left);
+        trie.nodes[node].right = static_cast<typename trie_type::ref_type>(right);
+        return Size + node;
+    }
+
+    template < std::size_t MaxLength, std::size_t Size >
+    constexpr name_trie<Size, MaxLength> make_name_trie(const std::array<std::string_view, Size>& keys) noexcept {
+        using trie_type = name_trie<Size, MaxLength>;
+
+        std::array<std::size_t, Size> sorted{};
+        for ( std::size_t i = 0; i < Size; ++i ) {
+            sorted[i] = i;
+        }
+
+        stable_sort(sorted, [&keys](std::size_t l, std::size_t r){
+            return name_less(keys[l], keys[r]);
+        });
+
+        // the sort is stable, so the first declared name wins
+        std::size_t unique = 0;
+        for ( std::size_t i = 0; i < Size; ++i ) {
+            if ( unique == 0 || keys[sorted[unique - 1]] != keys[sorted[i]] ) {
+                sorted[unique++] = sorted[i];
+            }
+        }
+
+        trie_type trie{};
+        for ( typename trie_type::ref_type& root : trie.roots ) {
+            root = trie_type::empty_ref;
+        }
+
+        std::size_t node_count = 0;
+        for ( std::size_t first = 0; first < unique; ) {
+            const std::size_t length = keys[sorted[first]].size();
+            std::size_t last = first + 1;
+            while ( last < unique && keys[sorted[last]].size() == length ) {
+                ++last;
+            }
+            trie.roots[length] = static_cast<typename trie_type::ref_type>(
+                build_name_trie_node(trie, node_count, keys, sorted, first, last));
+            first = last;
+        }
+
+        return trie;
+    }
+
+    //
+    // make_name_index
+    //
+
+    template < lookup_strategy Strategy, std::size_t MaxLength, std::size_t Size >
+    constexpr auto make_name_index(const std::array<std::string_view, Size>& keys) noexcept {
+        if constexpr ( Strategy == lookup_strategy::binary_search ) {
+            return make_sorted_search(keys);
+        } else if constexpr ( Strategy == lookup_strategy::perfect_hash ) {
+            return make_perfect_hash(keys);
+        } else if constexpr ( Strategy == lookup_strategy::trie ) {
+            return make_name_trie<MaxLength>(keys);
+        } else if constexpr ( Strategy == lookup_strategy::hash_table ) {
+            return make_hash_table(keys);
+        } else {
+            return linear_search<Size>{};
+        }
+    }
+
+    // a few names are faster to compare than to hash, long names are faster
+    // to dispatch by a few discriminating bits than to hash as a whole
+    constexpr lookup_strategy choose_lookup_strategy(std::size_t size, std::size_t total_length) noexcept {
+        if ( size <= 4 ) {
+            return lookup_strategy::linear;
+        }
+        if ( total_length >= size * 16 ) {
+            return lookup_strategy::trie;
+        }
+        if ( size <= 8 ) {
+            return lookup_strategy::binary_search;
+        }
+        return lookup_strategy::perfect_hash;
+    }
+}
+
+//
+// ENUM_HPP_FIELD_DECL
+//
+// a field is either `name [= value]` or `(name [= value])(alias)...`
+//
+
+#define ENUM_HPP_FIELD_DECL(x)\
+    ENUM_HPP_PP_IIF(ENUM_HPP_PP_IS_PAREN(x), ENUM_HPP_PP_SEQ_HEAD, ENUM_HPP_PP_IDENTITY)(x)
+
+//
+// ENUM_HPP_GENERATE_FIELDS
+//
+
+#define ENUM_HPP_GENERATE_FIELDS_A(x) ENUM_HPP_FIELD_DECL(x), ENUM_HPP_GENERATE_FIELDS_B
+#define ENUM_HPP_GENERATE_FIELDS_B(x) ENUM_HPP_FIELD_DECL(x), ENUM_HPP_GENERATE_FIELDS_A
+#define ENUM_HPP_GENERATE_FIELDS_A_END
+#define ENUM_HPP_GENERATE_FIELDS_B_END
+
+#define ENUM_HPP_GENERATE_FIELDS(Fields)\
+    ENUM_HPP_PP_SEQ_END(ENUM_HPP_GENERATE_FIELDS_A Fields)
+
+//
+// ENUM_HPP_GENERATE_VALUES
+//
+// used inside traits, `enum_type::` is there instead of the enum name
+//
+
+#define ENUM_HPP_GENERATE_VALUES_OP(x)\
+    ((::enum_hpp::detail::ignore_assign<enum_type>)enum_type::ENUM_HPP_FIELD_DECL(x)).value,
+
+#define ENUM_HPP_GENERATE_VALUES_A(x) ENUM_HPP_GENERATE_VALUES_OP(x) ENUM_HPP_GENERATE_VALUES_B
+#define ENUM_HPP_GENERATE_VALUES_B(x) ENUM_HPP_GENERATE_VALUES_OP(x) ENUM_HPP_GENERATE_VALUES_A
+#define ENUM_HPP_GENERATE_VALUES_A_END
+#define ENUM_HPP_GENERATE_VALUES_B_END
+
+#define ENUM_HPP_GENERATE_VALUES(Fields)\
+    ENUM_HPP_PP_SEQ_END(ENUM_HPP_GENERATE_VALUES_A Fields)
+
+//
+// ENUM_HPP_GENERATE_NAMES
+//
+// one trim_raw_name call per field, cheaper to evaluate than a loop
+// filling one array
+//
+
+#define ENUM_HPP_GENERATE_NAMES_OP(x)\
+    ::enum_hpp::detail::trim_raw_name(ENUM_HPP_PP_STRINGIZE(ENUM_HPP_FIELD_DECL(x))),
+
+#define ENUM_HPP_GENERATE_NAMES_A(x) ENUM_HPP_GENERATE_NAMES_OP(x) ENUM_HPP_GENERATE_NAMES_B
+#define ENUM_HPP_GENERATE_NAMES_B(x) ENUM_HPP_GENERATE_NAMES_OP(x) ENUM_HPP_GENERATE_NAMES_A
+#define ENUM_HPP_GENERATE_NAMES_A_END
+#define ENUM_HPP_GENERATE_NAMES_B_END
+
+#define ENUM_HPP_GENERATE_NAMES(Fields)\
+    ENUM_HPP_PP_SEQ_END(ENUM_HPP_GENERATE_NAMES_A Fields)
+
+//
+// ENUM_HPP_GENERATE_RAW_FIELDS
+//
+
+#define ENUM_HPP_GENERATE_RAW_FIELDS_A(x) ENUM_HPP_PP_STRINGIZE(x), ENUM_HPP_GENERATE_RAW_FIELDS_B
+#define ENUM_HPP_GENERATE_RAW_FIELDS_B(x) ENUM_HPP_PP_STRINGIZE(x), ENUM_HPP_GENERATE_RAW_FIELDS_A
+#define ENUM_HPP_GENERATE_RAW_FIELDS_A_END
+#define ENUM_HPP_GENERATE_RAW_FIELDS_B_END
+
+#define ENUM_HPP_GENERATE_RAW_FIELDS(Fields)\
+    ENUM_HPP_PP_SEQ_END(ENUM_HPP_GENERATE_RAW_FIELDS_A Fields)
+
+//
+// ENUM_HPP_DECL
+//
+
+#define ENUM_HPP_DECL(Enum, Type, Fields)\
+    enum Enum : Type {\
+        ENUM_HPP_GENERATE_FIELDS(Fields)\
+    };\
+    ENUM_HPP_TRAITS_DECL(Enum, Fields)
+
+//
+// ENUM_HPP_CLASS_DECL
+//
+
+#define ENUM_HPP_CLASS_DECL(Enum, Type, Fields)\
+    enum class Enum : Type {\
+        ENUM_HPP_GENERATE_FIELDS(Fields)\
+    };\
+    ENUM_HPP_TRAITS_DECL(Enum, Fields)
+
+//
+// ENUM_HPP_DECL_V
+//
+
+#define ENUM_HPP_DECL_V(Enum, Type, ...)\
+    enum Enum : Type {\
+        __VA_ARGS__\
+    };\
+    ENUM_HPP_TRAITS_DECL_V(Enum, __VA_ARGS__)
+
+//
+// ENUM_HPP_CLASS_DECL_V
+//
+
+#define ENUM_HPP_CLASS_DECL_V(Enum, Type, ...)\
+    enum class Enum : Type {\
+        __VA_ARGS__\
+    };\
+    ENUM_HPP_TRAITS_DECL_V(Enum, __VA_ARGS__)
+
+//
+// ENUM_HPP_TRAITS_DECL
+//
+
+#define ENUM_HPP_TRAITS_DECL(Enum, Fields)\
+    ENUM_HPP_TRAITS_DECL_I(Enum, Enum##_traits final, Fields)
+
+#define ENUM_HPP_TRAITS_DECL_I(Enum, Traits, Fields)\
+    struct Traits {\
+    private:\
+        enum enum_names_for_this_score_ {\
+            ENUM_HPP_GENERATE_FIELDS(Fields)\
+        };\
+    public:\
+        using enum_type = Enum;\
+        using underlying_type = std::underlying_type_t<enum_type>;\
+        static constexpr std::string_view type_name = #Enum;\
+        static constexpr std::size_t size = ENUM_HPP_PP_SEQ_SIZE(Fields);\
+        \
+        static constexpr const std::array<enum_type, size> values = {\
+            { ENUM_HPP_GENERATE_VALUES(Fields) }\
+        };\
+    private:\
+        static constexpr const std::array<std::string_view, size> raw_fields = {\
+            { ENUM_HPP_GENERATE_RAW_FIELDS(Fields) }\
+        };\
+        static constexpr const std::array<std::string_view, size> field_names = {\
+            { ENUM_HPP_GENERATE_NAMES(Fields) }\
+        };\
+        ENUM_HPP_TRAITS_BODY(Enum)\
+    };
+
+//
+// ENUM_HPP_DECL_EXTERN
+//
+
+#define ENUM_HPP_DECL_EXTERN(Enum, Type, Fields)\
+    enum Enum : Type {\
+        ENUM_HPP_GENERATE_FIELDS(Fields)\
+    };\
+    ENUM_HPP_TRAITS_DECL_EXTERN(Enum, Fields)
+
+//
+// ENUM_HPP_CLASS_DECL_EXTERN
+//
+
+#define ENUM_HPP_CLASS_DECL_EXTERN(Enum, Type, Fields)\
+    enum class Enum : Type {\
+        ENUM_HPP_GENERATE_FIELDS(Fields)\
+    };\
+    ENUM_HPP_TRAITS_DECL_EXTERN(Enum, Fields)
+
+//
+// ENUM_HPP_TRAITS_DECL_EXTERN
+//
+// the traits get the constexpr data from Enum_inline_traits and only declare
+// the functions searching the tables, ENUM_HPP_TRAITS_DEFINE defines them in
+// one translation unit, so they are compiled once and are not constexpr
+//
+
+#define ENUM_HPP_TRAITS_DECL_EXTERN(Enum, Fields)\
+    ENUM_HPP_TRAITS_DECL_I(Enum, Enum##_inline_traits, Fields)\
+    struct Enum##_traits final : Enum##_inline_traits {\
+        static std::optional<enum_type> from_underlying(underlying_type value) noexcept;\
+        static enum_type from_underlying_or_default(underlying_type value, enum_type def) noexcept;\
+        static enum_type from_underlying_or_throw(underlying_type value);\
+        static std::size_t validate(const underlying_type* data, std::size_t count) noexcept;\
+        ENUM_HPP_TRAITS_EXTERN_NAMES\
+        static std::optional<enum_type> from_name_hash(std::uint64_t hash) noexcept;\
+        static enum_type from_name_hash_or_default(std::uint64_t hash, enum_type def) noexcept;\
+        static enum_type from_name_hash_or_throw(std::uint64_t hash);\
+        static std::optional<std::size_t> to_index(enum_type e) noexcept;\
+        static std::size_t to_index_or_invalid(enum_type e) noexcept;\
+        static std::size_t to_index_or_throw(enum_type e);\
+    };
+
+#if defined(ENUM_HPP_NO_NAMES)
+#  define ENUM_HPP_TRAITS_EXTERN_NAMES\
+    static std::optional<std::uint64_t> to_string(enum_type e) noexcept;\
+    static std::uint64_t to_string_or_throw(enum_type e);
+#else
+#  define ENUM_HPP_TRAITS_EXTERN_NAMES\
+    static std::optional<std::string_view> to_string(enum_type e) noexcept;\
+    static std::string_view to_string_or_empty(enum_type e) noexcept;\
+    static std::string_view to_string_or_throw(enum_type e);\
+    static const char* to_c_str(enum_type e) noexcept;\
+    static const char* to_c_str_or_empty(enum_type e) noexcept;\
+    static const char* to_c_str_or_throw(enum_type e);\
+    static std::optional<enum_type> from_string(std::string_view name) noexcept;\
+    static enum_type from_string_or_default(std::string_view name, enum_type def) noexcept;\
+    static enum_type from_string_or_throw(std::string_view name);\
+    static ::enum_hpp::parse_result<enum_type> parse_prefix(const char* first, const char* last, std::string_view delimiters = {}) noexcept;\
+    static std::size_t from_strings(const std::string_view* strings, std::size_t count, enum_type* out, bool* found = nullptr) noexcept;\
+    static std::optional<enum_type> from_string_icase(std::string_view name) noexcept;\
+    static enum_type from_string_icase_or_default(std::string_view name, enum_type def) noexcept;\
+    static enum_type from_string_icase_or_throw(std::string_view name);
+#endif
+
+//
+// ENUM_HPP_TRAITS_DEFINE
+//
+// in one source file, in the namespace of ENUM_HPP_TRAITS_DECL_EXTERN
+//
+
+#define ENUM_HPP_TRAITS_DEFINE(Enum)\
+    auto Enum##_traits::from_underlying(underlying_type value) noexcept -> std::optional<enum_type> {\
+        return Enum##_inline_traits::from_underlying(value);\
+    }\
+    auto Enum##_traits::from_underlying_or_default(underlying_type value, enum_type def) noexcept -> enum_type {\
+        return Enum##_inline_traits::from_underlying_or_default(value, def);\
+    }\
+    auto Enum##_traits::from_underlying_or_throw(underlying_type value) -> enum_type {\
+        return Enum##_inline_traits::from_underlying_or_throw(value);\
+    }\
+    auto Enum##_traits::validate(const underlying_type* data, std::size_t count) noexcept -> std::size_t {\
+        return Enum##_inline_traits::validate(data, count);\
+    }\
+    ENUM_HPP_TRAITS_DEFINE_NAMES(Enum)\
+    auto Enum##_traits::from_name_hash(std::uint64_t hash) noexcept -> std::optional<enum_type> {\
+        return Enum##_inline_traits::from_name_hash(hash);\
+    }\
+    auto Enum##_traits::from_name_hash_or_default(std::uint64_t hash, enum_type def) noexcept -> enum_type {\
+        return Enum##_inline_traits::from_name_hash_or_default(hash, def);\
+    }\
+    auto Enum##_traits::from_name_hash_or_throw(std::uint64_t hash) -> enum_type {\
+        return Enum##_inline_traits::from_name_hash_or_throw(hash);\
+    }\
+    auto Enum##_traits::to_index(enum_type e) noexcept -> std::optional<std::size_t> {\
+        return Enum##_inline_traits::to_index(e);\
+    }\
+    auto Enum##_traits::to_index_or_invalid(enum_type e) noexcept -> std::size_t {\
+        return Enum##_inline_traits::to_index_or_invalid(e);\
+    }\
+    auto Enum##_traits::to_index_or_throw(enum_type e) -> std::size_t {\
+        return Enum##_inline_traits::to_index_or_throw(e);\
+    }
+
+#if defined(ENUM_HPP_NO_NAMES)
+#  define ENUM_HPP_TRAITS_DEFINE_NAMES(Enum)\
+    auto Enum##_traits::to_string(enum_type e) noexcept -> std::optional<std::uint64_t> {\
+        return Enum##_inline_traits::to_string(e);\
+    }\
+    auto Enum##_traits::to_string_or_throw(enum_type e) -> std::uint64_t {\
+        return Enum##_inline_traits::to_string_or_throw(e);\
+    }
+#else
+#  define ENUM_HPP_TRAITS_DEFINE_NAMES(Enum)\
+    auto Enum##_traits::to_string(enum_type e) noexcept -> std::optional<std::string_view> {\
+        return Enum##_inline_traits::to_string(e);\
+    }\
+    auto Enum##_traits::to_string_or_empty(enum_type e) noexcept -> std::string_view {\
+        return Enum##_inline_traits::to_string_or_empty(e);\
+    }\
+    auto Enum##_traits::to_string_or_throw(enum_type e) -> std::string_view {\
+        return Enum##_inline_traits::to_string_or_throw(e);\
+    }\
+    auto Enum##_traits::to_c_str(enum_type e) noexcept -> const char* {\
+        return Enum##_inline_traits::to_c_str(e);\
+    }\
+    auto Enum##_traits::to_c_str_or_empty(enum_type e) noexcept -> const char* {\
+        return Enum##_inline_traits::to_c_str_or_empty(e);\
+    }\
+    auto Enum##_traits::to_c_str_or_throw(enum_type e) -> const char* {\
+        return Enum##_inline_traits::to_c_str_or_throw(e);\
+    }\
+    auto Enum##_traits::from_string(std::string_view name) noexcept -> std::optional<enum_type> {\
+        return Enum##_inline_traits::from_string(name);\
+    }\
+    auto Enum##_traits::from_string_or_default(std::string_view name, enum_type def) noexcept -> enum_type {\
+        return Enum##_inline_traits::from_string_or_default(name, def);\
+    }\
+    auto Enum##_traits::from_string_or_throw(std::string_view name) -> enum_type {\
+        return Enum##_inline_traits::from_string_or_throw(name);\
+    }\
+    auto Enum##_traits::parse_prefix(const char* first, const char* last, std::string_view delimiters) noexcept -> ::enum_hpp::parse_result<enum_type> {\
+        return Enum##_inline_traits::parse_prefix(first, last, delimiters);\
+    }\
+    auto Enum##_traits::from_strings(const std::string_view* strings, std::size_t count, enum_type* out, bool* found) noexcept -> std::size_t {\
+        return Enum##_inline_traits::from_strings(strings, count, out, found);\
+    }\
+    auto Enum##_traits::from_string_icase(std::string_view name) noexcept -> std::optional<enum_type> {\
+        return Enum##_inline_traits::from_string_icase(name);\
+    }\
+    auto Enum##_traits::from_string_icase_or_default(std::string_view name, enum_type def) noexcept -> enum_type {\
+        return Enum##_inline_traits::from_string_icase_or_default(name, def);\
+    }\
+    auto Enum##_traits::from_string_icase_or_throw(std::string_view name) -> enum_type {\
+        return Enum##_inline_traits::from_string_icase_or_throw(name);\
+    }
+#endif
+
+//
+// ENUM_HPP_TRAITS_DECL_V
+//
+// the fields are declared as local variables and assigned again in one
+// comma expression, so values are computed like in the enum declaration
+// without walking the fields by the preprocessor
+//
+
+#define ENUM_HPP_TRAITS_DECL_V(Enum, ...)\
+    struct Enum##_traits final {\
+    public:\
+        using enum_type = Enum;\
+        using underlying_type = std::underlying_type_t<enum_type>;\
+        static constexpr std::string_view type_name = #Enum;\
+    private:\
+        static constexpr std::string_view raw_field_list = #__VA_ARGS__;\
+    public:\
+        static constexpr std::size_t size = ::enum_hpp::detail::count_raw_field_list(raw_field_list);\
+    private:\
+        static constexpr const auto field_values = [](){\
+            using enum_hpp_values_type_ = std::array<underlying_type, size>;\
+            ::enum_hpp::detail::field_values<underlying_type> enum_hpp_field_values_{};\
+            ::enum_hpp::detail::field_value<underlying_type> __VA_ARGS__;\
+            static_cast<void>((enum_hpp_field_values_, __VA_ARGS__));\
+            return std::make_pair(enum_hpp_field_values_.count, enum_hpp_values_type_{ { __VA_ARGS__ } });\
+        }();\
+        static_assert(field_values.first == size, #Enum "_traits: unexpected comma in a field");\
+    public:\
+        static constexpr const std::array<enum_type, size> values =\
+            ::enum_hpp::detail::to_enum_values<enum_type>(field_values.second);\
+    private:\
+        static constexpr const std::array<std::string_view, size> raw_fields =\
+            ::enum_hpp::detail::split_raw_field_list<size>(raw_field_list);\
+        static constexpr const std::array<std::string_view, size> field_names =\
+            ::enum_hpp::detail::make_field_names(raw_fields);\
+        ENUM_HPP_TRAITS_BODY(Enum)\
+    };
+
+//
+// ENUM_HPP_TRAITS_BODY
+//
+
+#define ENUM_HPP_TRAITS_BODY(Enum)\
+    public:\
+        static constexpr underlying_type min_value = ::enum_hpp::detail::min_enum_value(values);\
+        static constexpr underlying_type max_value = ::enum_hpp::detail::max_enum_value(values);\
+        static constexpr bool is_single_bit = ::enum_hpp::detail::is_single_bit_values(values);\
+        static constexpr bool is_contiguous = ::enum_hpp::detail::is_contiguous_values(values);\
+    private:\
+        template < typename Lazy = void >\
+        static constexpr const auto values_index = ::enum_hpp::detail::make_value_index<\
+            ::enum_hpp::detail::dense_value_span(::enum_hpp::detail::lazy<Lazy>(values)), is_single_bit>(values);\
+        template < typename Lazy = void >\
+        static constexpr const auto values_bitmap = ::enum_hpp::detail::make_value_bitmap<\
+            ::enum_hpp::detail::value_bitmap_words(::enum_hpp::detail::lazy<Lazy>(values))>(values);\
+    public:\
+        static constexpr const std::array<std::uint64_t, size> name_hashes =\
+            ::enum_hpp::detail::make_name_hashes(field_names);\
+    private:\
+        template < typename Lazy = void >\
+        static constexpr const ::enum_hpp::detail::name_hash_index<size> name_hashes_index =\
+            ::enum_hpp::detail::make_name_hash_index(::enum_hpp::detail::lazy<Lazy>(name_hashes));\
+    public:\
+        template < typename Lazy = void >\
+        static constexpr bool name_hashes_unique = name_hashes_index<Lazy>.unique();\
+        ENUM_HPP_TRAITS_NAMES(Enum)\
+    public:\
+        [[maybe_unused]] static constexpr underlying_type to_underlying(enum_type e) noexcept {\
+            return static_cast<underlying_type>(e);\
+        }\
+        template < typename Lazy = void >\
+        [[maybe_unused]] static constexpr std::optional<enum_type> from_underlying(underlying_type value) noexcept {\
+            if ( values_index<Lazy>.find(static_cast<enum_type>(value)) != ::enum_hpp::invalid_index ) {\
+                return static_cast<enum_type>(value);\
+            }\
+            return std::nullopt;\
+        }\
+        template < typename = void >\
+        [[maybe_unused]] static constexpr enum_type from_underlying_or_default(underlying_type value, enum_type def) noexcept {\
+            if ( auto e = from_underlying(value) ) {\
+                return *e;\
+            }\
+            return def;\
+        }\
+        template < typename = void >\
+        [[maybe_unused]] static enum_type from_underlying_or_throw(underlying_type value) {\
+            if ( auto e = from_underlying(value) ) {\
+                return *e;\
+            }\
+            ::enum_hpp::detail::throw_exception_with(ENUM_HPP_TRAITS_ERROR(Enum, from_underlying_or_throw));\
+        }\
+        template < typename Lazy = void >\
+        [[maybe_unused]] static constexpr std::size_t validate(const underlying_type* data, std::size_t count) noexcept {\
+            return ::enum_hpp::detail::find_invalid_value(values_bitmap<Lazy>, values_index<Lazy>, data, count);\
+        }\
+        template < typename Lazy = void >\
+        [[maybe_unused]] static constexpr std::optional<enum_type> from_name_hash(std::uint64_t hash) noexcept {\
+            static_assert(name_hashes_unique<Lazy>, #Enum "_traits: field name hash collision");\
+            if ( const std::size_t i = name_hashes_index<Lazy>.find(hash); i != ::enum_hpp::invalid_index ) {\
+                return values[i];\
+            }\
+            return std::nullopt;\
+        }\
+        template < typename = void >\
+        [[maybe_unused]] static constexpr enum_type from_name_hash_or_default(std::uint64_t hash, enum_type def) noexcept {\
+            if ( auto e = from_name_hash(hash) ) {\
+                return *e;\
+            }\
+            return def;\
+        }\
+        template < typename = void >\
+        [[maybe_unused]] static enum_type from_name_hash_or_throw(std::uint64_t hash) {\
+            if ( auto e = from_name_hash(hash) ) {\
+                return *e;\
+            }\
+            ::enum_hpp::detail::throw_exception_with(ENUM_HPP_TRAITS_ERROR(Enum, from_name_hash_or_throw));\
+        }\
+        template < typename Lazy = void >\
+        [[maybe_unused]] static constexpr std::optional<std::size_t> to_index(enum_type e) noexcept {\
+            if ( const std::size_t i = values_index<Lazy>.find(e); i != ::enum_hpp::invalid_index ) {\
+                return i;\
+            }\
+            return std::nullopt;\
+        }\
+        template < typename = void >\
+        [[maybe_unused]] static constexpr std::size_t to_index_or_invalid(enum_type e) noexcept {\
+            if ( auto i = to_index(e) ) {\
+                return *i;\
+            }\
+            return ::enum_hpp::invalid_index;\
+        }\
+        template < typename = void >\
+        [[maybe_unused]] static std::size_t to_index_or_throw(enum_type e) {\
+            if ( auto i = to_index(e) ) {\
+                return *i;\
+            }\
+            ::enum_hpp::detail::throw_exception_with(ENUM_HPP_TRAITS_ERROR(Enum, to_index_or_throw));\
+        }\
+        [[maybe_unused]] static constexpr std::optional<enum_type> from_index(std::size_t index) noexcept {\
+            if ( index < size ) {\
+                return values[index];\
+            }\
+            return std::nullopt;\
+        }\
+        [[maybe_unused]] static constexpr enum_type from_index_or_default(std::size_t index, enum_type def) noexcept {\
+            if ( auto e = from_index(index) ) {\
+                return *e;\
+            }\
+            return def;\
+        }\
+        [[maybe_unused]] static enum_type from_index_or_throw(std::size_t index) {\
+            if ( auto e = from_index(index) ) {\
+                return *e;\
+            }\
+            ::enum_hpp::detail::throw_exception_with(ENUM_HPP_TRAITS_ERROR(Enum, from_index_or_throw));\
+        }
+
+//
+// ENUM_HPP_TRAITS_NAMES
+//
+// the names are only used at compile time with ENUM_HPP_NO_NAMES,
+// to_string returns the name hash of the field instead
+//
+
+#if defined(ENUM_HPP_NO_NAMES)
+#  define ENUM_HPP_TRAITS_NAMES(Enum)\
+    public:\
+        template < typename Lazy = void >\
+        [[maybe_unused]] static constexpr std::optional<std::uint64_t> to_string(enum_type e) noexcept {\
+            static_assert(name_hashes_unique<Lazy>, #Enum "_traits: field name hash collision");\
+            if ( const std::size_t i = values_index<Lazy>.find(e); i != ::enum_hpp::invalid_index ) {\
+                return name_hashes[i];\
+            }\
+            return std::nullopt;\
+        }\
+        template < typename = void >\
+        [[maybe_unused]] static std::uint64_t to_string_or_throw(enum_type e) {\
+            if ( auto s = to_string(e) ) {\
+                return *s;\
+            }\
+            ::enum_hpp::detail::throw_exception_with(ENUM_HPP_TRAITS_ERROR(Enum, to_string_or_throw));\
+        }
+#else
+#  define ENUM_HPP_TRAITS_NAMES(Enum)\
+    private:\
+        static constexpr std::size_t alias_count = ::enum_hpp::detail::count_field_aliases(raw_fields);\
+        static constexpr std::size_t lookup_size = size + alias_count;\
+    public:\
+        static constexpr std::size_t max_name_length = ::enum_hpp::detail::max_name_length(field_names);\
+        static constexpr ::enum_hpp::lookup_strategy lookup = ::enum_hpp::detail::choose_lookup_strategy(\
+            lookup_size, ::enum_hpp::detail::total_name_length(field_names) + ::enum_hpp::detail::total_alias_length(raw_fields));\
+    private:\
+        template < typename Lazy = void >\
+        static constexpr const std::array<std::string_view, lookup_size> lookup_names =\
+            ::enum_hpp::detail::make_lookup_names<alias_count>(::enum_hpp::detail::lazy<Lazy>(field_names), raw_fields);\
+        template < typename Lazy = void >\
+        static constexpr const std::array<enum_type, lookup_size> lookup_values =\
+            ::enum_hpp::detail::make_lookup_values<alias_count>(::enum_hpp::detail::lazy<Lazy>(values), raw_fields);\
+        template < typename Lazy = void >\
+        static constexpr std::size_t max_lookup_name_length = ::enum_hpp::detail::max_name_length(lookup_names<Lazy>);\
+        \
+        template < typename Fold, typename Lazy = void >\
+        static constexpr const auto folded_names_pool = ::enum_hpp::detail::make_name_pool<\
+            ::enum_hpp::detail::total_name_length(lookup_names<Lazy>)>(lookup_names<Lazy>, Fold{});\
+        \
+        template < typename Lazy = void >\
+        static constexpr const auto& names_pool = folded_names_pool<::enum_hpp::detail::identity_fold, Lazy>;\
+    public:\
+        template < typename Lazy = void >\
+        static constexpr const std::array<std::string_view, size> names = names_pool<Lazy>.template views<size>();\
+        template < typename Lazy = void >\
+        static constexpr const std::array<const char*, size> c_names = names_pool<Lazy>.template c_strs<size>();\
+    private:\
+        template < ::enum_hpp::lookup_strategy Strategy, typename Lazy = void >\
+        static constexpr const auto names_index = ::enum_hpp::detail::make_name_index<\
+            Strategy, max_lookup_name_length<Lazy>>(names_pool<Lazy>.views());\
+        \
+        template < ::enum_hpp::lookup_strategy Strategy, typename Lazy = void >\
+        static constexpr const auto folded_names_index = ::enum_hpp::detail::make_name_index<\
+            Strategy, max_lookup_name_length<Lazy>>(folded_names_pool<::enum_hpp::detail::ascii_lower_fold, Lazy>.views());\
+    public:\
+        template < typename Lazy = void >\
+        [[maybe_unused]] static constexpr std::optional<std::string_view> to_string(enum_type e) noexcept {\
+            if ( const std::size_t i = values_index<Lazy>.find(e); i != ::enum_hpp::invalid_index ) {\
+                return names_pool<Lazy>[i];\
+            }\
+            return std::nullopt;\
+        }\
+        template < typename = void >\
+        [[maybe_unused]] static constexpr std::string_view to_string_or_empty(enum_type e) noexcept {\
+            if ( auto s = to_string(e) ) {\
+                return *s;\
+            }\
+            return ::enum_hpp::empty_string;\
+        }\
+        template < typename = void >\
+        [[maybe_unused]] static std::string_view to_string_or_throw(enum_type e) {\
+            if ( auto s = to_string(e) ) {\
+                return *s;\
+            }\
+            ::enum_hpp::detail::throw_exception_with(ENUM_HPP_TRAITS_ERROR(Enum, to_string_or_throw));\
+        }\
+        template < typename Lazy = void >\
+        [[maybe_unused]] static constexpr const char* to_c_str(enum_type e) noexcept {\
+            if ( const std::size_t i = values_index<Lazy>.find(e); i != ::enum_hpp::invalid_index ) {\
+                return c_names<Lazy>[i];\
+            }\
+            return nullptr;\
+        }\
+        template < typename Lazy = void >\
+        [[maybe_unused]] static constexpr const char* to_c_str_or_empty(enum_type e) noexcept {\
+            if ( const std::size_t i = values_index<Lazy>.find(e); i != ::enum_hpp::invalid_index ) {\
+                return c_names<Lazy>[i];\
+            }\
+            return "";\
+        }\
+        template < typename Lazy = void >\
+        [[maybe_unused]] static const char* to_c_str_or_throw(enum_type e) {\
+            if ( const std::size_t i = values_index<Lazy>.find(e); i != ::enum_hpp::invalid_index ) {\
+                return c_names<Lazy>[i];\
+            }\
+            ::enum_hpp::detail::throw_exception_with(ENUM_HPP_TRAITS_ERROR(Enum, to_c_str_or_throw));\
+        }\
+        template < typename = void >\
+        [[maybe_unused]] static constexpr std::optional<enum_type> from_string(std::string_view name) noexcept {\
+            return from_string_with<lookup>(name);\
+        }\
+        template < typename = void >\
+        [[maybe_unused]] static constexpr enum_type from_string_or_default(std::string_view name, enum_type def) noexcept {\
+            if ( auto e = from_string(name) ) {\
+                return *e;\
+            }\
+            return def;\
+        }\
+        template < typename = void >\
+        [[maybe_unused]] static enum_type from_string_or_throw(std::string_view name) {\
+            if ( auto e = from_string(name) ) {\
+                return *e;\
+            }\
+            throw_invalid_name();\
+        }\
+        template < bool ICase = false >\
+        [[noreturn, maybe_unused]] static void throw_invalid_name() {\
+            if constexpr ( ICase ) {\
+                ::enum_hpp::detail::throw_exception_with(ENUM_HPP_TRAITS_ERROR(Enum, from_string_icase_or_throw));\
+            } else {\
+                ::enum_hpp::detail::throw_exception_with(ENUM_HPP_TRAITS_ERROR(Enum, from_string_or_throw));\
+            }\
+        }\
+        template < ::enum_hpp::lookup_strategy Strategy, typename Lazy = void >\
+        [[maybe_unused]] static constexpr std::optional<enum_type> from_string_with(std::string_view name) noexcept {\
+            if ( const std::size_t i = names_index<Strategy, Lazy>.find(names_pool<Lazy>, name); i != ::enum_hpp::invalid_index ) {\
+                return lookup_values<Lazy>[i];\
+            }\
+            return std::nullopt;\
+        }\
+        template < typename = void >\
+        [[maybe_unused]] static constexpr ::enum_hpp::parse_result<enum_type> parse_prefix(const char* first, const char* last, std::string_view delimiters = {}) noexcept {\
+            return parse_prefix_with<lookup>(first, last, delimiters);\
+        }\
+        template < ::enum_hpp::lookup_strategy Strategy, typename Lazy = void >\
+        [[maybe_unused]] static constexpr ::enum_hpp::parse_result<enum_type> parse_prefix_with(const char* first, const char* last, std::string_view delimiters = {}) noexcept {\
+            const auto match = ::enum_hpp::detail::find_name_prefix<max_lookup_name_length<Lazy>>(\
+                names_index<Strategy, Lazy>,\
+                names_pool<Lazy>,\
+                std::string_view(first, static_cast<std::size_t>(last - first)),\
+                delimiters);\
+            if ( match.first != ::enum_hpp::invalid_index ) {\
+                return {first + match.second, lookup_values<Lazy>[match.first]};\
+            }\
+            return {first, std::nullopt};\
+        }\
+        template < typename = void >\
+        [[maybe_unused]] static constexpr std::size_t from_strings(const std::string_view* strings, std::size_t count, enum_type* out, bool* found = nullptr) noexcept {\
+            return from_strings_with<lookup>(strings, count, out, found);\
+        }\
+        template < ::enum_hpp::lookup_strategy Strategy, typename Lazy = void >\
+        [[maybe_unused]] static constexpr std::size_t from_strings_with(const std::string_view* strings, std::size_t count, enum_type* out, bool* found = nullptr) noexcept {\
+            return ::enum_hpp::detail::find_names_batch(\
+                names_index<Strategy, Lazy>, names_pool<Lazy>, lookup_values<Lazy>, strings, count, out, found);\
+        }\
+        template < typename = void >\
+        [[maybe_unused]] static constexpr std::optional<enum_type> from_string_icase(std::string_view name) noexcept {\
+            return from_string_icase_with<lookup>(name);\
+        }\
+        template < typename = void >\
+        [[maybe_unused]] static constexpr enum_type from_string_icase_or_default(std::string_view name, enum_type def) noexcept {\
+            if ( auto e = from_string_icase(name) ) {\
+                return *e;\
+            }\
+            return def;\
+        }\
+        template < typename = void >\
+        [[maybe_unused]] static enum_type from_string_icase_or_throw(std::string_view name) {\
+            if ( auto e = from_string_icase(name) ) {\
+                return *e;\
+            }\
+            throw_invalid_name<true>();\
+        }\
+        template < ::enum_hpp::lookup_strategy Strategy, typename Lazy = void >\
+        [[maybe_unused]] static constexpr std::optional<enum_type> from_string_icase_with(std::string_view name) noexcept {\
+            const ::enum_hpp::detail::ascii_lower_fold fold{};\
+            if ( const std::size_t i = folded_names_index<Strategy, Lazy>.find(folded_names_pool<::enum_hpp::detail::ascii_lower_fold, Lazy>, name, fold); i != ::enum_hpp::invalid_index ) {\
+                return lookup_values<Lazy>[i];\
+            }\
+            return std::nullopt;\
+        }
+#endif
+
+//
+// ENUM_HPP_REGISTER_TRAITS
+//
+
+#define ENUM_HPP_REGISTER_TRAITS(Enum)\
+    constexpr Enum##_traits enum_hpp_adl_find_registered_traits [[maybe_unused]] (Enum) noexcept {\
+        return Enum##_traits{};\
+    }
+
+// -----------------------------------------------------------------------------
+//
+// ENUM_HPP_PP
+//
+// -----------------------------------------------------------------------------
+
+//
+// ENUM_HPP_PP_CAT
+//
+
+#define ENUM_HPP_PP_CAT(x, y) ENUM_HPP_PP_CAT_I(x, y)
+#define ENUM_HPP_PP_CAT_I(x, y) x ## y
+
+//
+// ENUM_HPP_PP_STRINGIZE
+//
+
+#define ENUM_HPP_PP_STRINGIZE(x) ENUM_HPP_PP_STRINGIZE_I(x)
+#define ENUM_HPP_PP_STRINGIZE_I(x) #x
+
+//
+// ENUM_HPP_PP_IDENTITY
+//
+
+#define ENUM_HPP_PP_IDENTITY(x) x
+
+//
+// ENUM_HPP_PP_IIF
+//
+
+#define ENUM_HPP_PP_IIF(c, t, f) ENUM_HPP_PP_IIF_I(c, t, f)
+#define ENUM_HPP_PP_IIF_I(c, t, f) ENUM_HPP_PP_IIF_ ## c(t, f)
+#define ENUM_HPP_PP_IIF_0(t, f) f
+#define ENUM_HPP_PP_IIF_1(t, f) t
+
+//
+// ENUM_HPP_PP_IS_PAREN
+//
+
+#define ENUM_HPP_PP_IS_PAREN(x) ENUM_HPP_PP_IS_PAREN_CHECK(ENUM_HPP_PP_IS_PAREN_PROBE x)
+#define ENUM_HPP_PP_IS_PAREN_PROBE(...) ~, 1,
+#define ENUM_HPP_PP_IS_PAREN_CHECK(...) ENUM_HPP_PP_IS_PAREN_CHECK_I((__VA_ARGS__, 0, ~))
+#define ENUM_HPP_PP_IS_PAREN_CHECK_I(args) ENUM_HPP_PP_IS_PAREN_CHECK_II args
+#define ENUM_HPP_PP_IS_PAREN_CHECK_II(x, n, ...) n
+
+//
+// ENUM_HPP_PP_SEQ_HEAD
+//
+
+#define ENUM_HPP_PP_SEQ_HEAD(seq) ENUM_HPP_PP_SEQ_HEAD_II((ENUM_HPP_PP_SEQ_HEAD_I seq))
+#define ENUM_HPP_PP_SEQ_HEAD_I(x) x, ENUM_HPP_PP_NOTHING
+#define ENUM_HPP_PP_SEQ_HEAD_II(p) ENUM_HPP_PP_SEQ_HEAD_III p
+#define ENUM_HPP_PP_SEQ_HEAD_III(x, _) x
+
+//
+// ENUM_HPP_PP_SEQ_END
+//
+// sequences are walked by two macros `X_A(x) ... X_B` and `X_B(x) ... X_A`
+// calling each other, so there is no nesting and no limit on the sequence
+// size. one of them is left after the last element and is pasted with `_END`.
+//
+
+#define ENUM_HPP_PP_SEQ_END(...) ENUM_HPP_PP_SEQ_END_I(__VA_ARGS__)
+#define ENUM_HPP_PP_SEQ_END_I(...) __VA_ARGS__ ## _END
+
+//
+// ENUM_HPP_PP_SEQ_SIZE
+//
+// expands to a constant expression, each element adds one character to a
+// string literal
+//
+
+#define ENUM_HPP_PP_SEQ_SIZE(seq)\
+    (sizeof(ENUM_HPP_PP_SEQ_END("" ENUM_HPP_PP_SEQ_SIZE_A seq)) - 1)
+
+#define ENUM_HPP_PP_SEQ_SIZE_A(...) "_" ENUM_HPP_PP_SEQ_SIZE_B
+#define ENUM_HPP_PP_SEQ_SIZE_B(...) "_" ENUM_HPP_PP_SEQ_SIZE_A
+#define ENUM_HPP_PP_SEQ_SIZE_A_END
+#define ENUM_HPP_PP_SEQ_SIZE_B_END
@@ -0,0 +1,121 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/enum.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2019-2023, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#pragma once
+
+#include "enum_core.hpp"
+#include "enum_string.hpp"
+#include "enum_bitflags.hpp"
+
+#include <array>
+#include <string_view>
+#include <type_traits>
+
+#if defined(__has_include)
+#  if __has_include(<version>)
+#    include <version>
+#  endif
+#endif
+
+#if defined(__cpp_lib_format) && __cpp_lib_format >= 201907L
+#  include <format>
+#  define ENUM_HPP_STD_FORMAT
+#endif
+
+//
+// Formatters write the field name or "Enum(value)" for unknown values,
+// bitflags are written like enum_hpp::bitflags::to_chars. Fill, align and
+// width work like for strings. Nothing is allocated, the text is built in
+// a stack buffer of max_chars_length() characters.
+//
+// std::formatter is declared when <format> is available, fmt::formatter
+// when <fmt/format.h> is included before this header.
+//
+
+namespace enum_hpp::detail
+{
+    template < typename Enum >
+    struct enum_chars final {
+        std::array<char, max_chars_length<Enum>()> chars{};
+        std::size_t length{};
+
+        explicit enum_chars(Enum e) noexcept {
+            const std::to_chars_result result = to_chars(chars.data(), chars.data() + chars.size(), e);
+            length = static_cast<std::size_t>(result.ptr - chars.data());
+        }
+
+        std::string_view view() const noexcept {
+            return std::string_view(chars.data(), length);
+        }
+    };
+
+    template < typename Enum >
+    struct bitflags_chars final {
+        std::array<char, bitflags::max_chars_length<Enum>()> chars{};
+        std::size_t length{};
+
+        explicit bitflags_chars(bitflags::bitflags<Enum> flags) noexcept {
+            const std::to_chars_result result = bitflags::to_chars(chars.data(), chars.data() + chars.size(), flags);
+            length = static_cast<std::size_t>(result.ptr - chars.data());
+        }
+
+        std::string_view view() const noexcept {
+            return std::string_view(chars.data(), length);
+        }
+    };
+}
+
+#if defined(ENUM_HPP_STD_FORMAT)
+namespace std
+{
+    template < typename Enum >
+        requires enum_hpp::detail::has_traits_v<Enum>
+    struct formatter<Enum, char> : formatter<string_view, char> {
+        template < typename FormatContext >
+        auto format(Enum e, FormatContext& ctx) const {
+            const enum_hpp::detail::enum_chars<Enum> chars(e);
+            return formatter<string_view, char>::format(chars.view(), ctx);
+        }
+    };
+
+    template < typename Enum >
+        requires enum_hpp::detail::has_traits_v<Enum>
+    struct formatter<enum_hpp::bitflags::bitflags<Enum>, char> : formatter<string_view, char> {
+        template < typename FormatContext >
+        auto format(enum_hpp::bitflags::bitflags<Enum> flags, FormatContext& ctx) const {
+            const enum_hpp::detail::bitflags_chars<Enum> chars(flags);
+            return formatter<string_view, char>::format(chars.view(), ctx);
+        }
+    };
+}
+#endif
+
+#if defined(FMT_VERSION)
+namespace fmt
+{
+    template < typename Enum >
+    struct formatter<Enum, char, std::enable_if_t<enum_hpp::detail::has_traits_v<Enum>>>
+        : formatter<string_view, char> {
+        template < typename FormatContext >
+        auto format(Enum e, FormatContext& ctx) const {
+            const enum_hpp::detail::enum_chars<Enum> chars(e);
+            return formatter<string_view, char>::format(
+                string_view(chars.view().data(), chars.view().size()), ctx);
+        }
+    };
+
+    template < typename Enum >
+    struct formatter<enum_hpp::bitflags::bitflags<Enum>, char, std::enable_if_t<enum_hpp::detail::has_traits_v<Enum>>>
+        : formatter<string_view, char> {
+        template < typename FormatContext >
+        auto format(enum_hpp::bitflags::bitflags<Enum> flags, FormatContext& ctx) const {
+            const enum_hpp::detail::bitflags_chars<Enum> chars(flags);
+            return formatter<string_view, char>::format(
+                string_view(chars.view().data(), chars.view().size()), ctx);
+        }
+    };
+}
+#endif
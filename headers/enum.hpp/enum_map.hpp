@@ -0,0 +1,239 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/enum.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2019-2023, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#pragma once
+
+//
+// enum_map<Enum, T>, one T per field stored in declaration order,
+// a lookup is to_index and an array access
+//
+
+#include "enum_core.hpp"
+#include "enum_throw.hpp"
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace enum_hpp
+{
+    template < typename Enum, typename T >
+    class enum_map final {
+        static_assert(std::is_enum_v<Enum>);
+    public:
+        using key_type = Enum;
+        using mapped_type = T;
+        using size_type = std::size_t;
+    private:
+        static constexpr bool has_shared_slots = detail::indexed_field_count<Enum>() != enum_hpp::size<Enum>();
+    public:
+        // the reference is a (key, value) pair made on the fly, so the iterator
+        // is only a C++17 input iterator, but a C++20 forward iterator
+        template < typename Value >
+        class basic_iterator final {
+        public:
+            using iterator_category = std::input_iterator_tag;
+        #if defined(__cpp_lib_ranges) && __cpp_lib_ranges >= 201911L
+            using iterator_concept = std::forward_iterator_tag;
+        #endif
+            using difference_type = std::ptrdiff_t;
+            using value_type = std::pair<Enum, Value&>;
+            using reference = value_type;
+            using pointer = void;
+
+            basic_iterator() = default;
+
+            constexpr basic_iterator(Value* data, std::size_t index) noexcept
+            : data_(data)
+            , index_(index) {
+                skip_shared_slots();
+            }
+
+            // iterator to const_iterator
+            template < typename Other
+                     , std::enable_if_t<std::is_same_v<const Other, Value>, int> = 0 >
+            constexpr basic_iterator(const basic_iterator<Other>& other) noexcept
+            : data_(other.data_)
+            , index_(other.index_) {}
+
+            constexpr reference operator*() const noexcept {
+                return {enum_hpp::values<Enum>()[index_], data_[index_]};
+            }
+
+            constexpr basic_iterator& operator++() noexcept {
+                ++index_;
+                skip_shared_slots();
+                return *this;
+            }
+
+            constexpr basic_iterator operator++(int) noexcept {
+                basic_iterator result = *this;
+                ++*this;
+                return result;
+            }
+
+            friend constexpr bool operator==(const basic_iterator& l, const basic_iterator& r) noexcept {
+                return l.index_ == r.index_;
+            }
+
+            friend constexpr bool operator!=(const basic_iterator& l, const basic_iterator& r) noexcept {
+                return l.index_ != r.index_;
+            }
+        private:
+            template < typename >
+            friend class basic_iterator;
+
+            // a field with the value of an earlier field has no key of its own
+            constexpr void skip_shared_slots() noexcept {
+                if constexpr ( has_shared_slots ) {
+                    while ( index_ < enum_hpp::size<Enum>() && !detail::is_indexed_field<Enum>(index_) ) {
+                        ++index_;
+                    }
+                }
+            }
+        private:
+            Value* data_{};
+            std::size_t index_{};
+        };
+
+        using iterator = basic_iterator<T>;
+        using const_iterator = basic_iterator<const T>;
+
+        enum_map() = default;
+
+        constexpr explicit enum_map(const T& value) {
+            fill(value);
+        }
+
+        // unlisted fields are value-initialized, throws on undeclared keys
+        constexpr enum_map(std::initializer_list<std::pair<Enum, T>> init) {
+            for ( const std::pair<Enum, T>& item : init ) {
+                at(item.first) = item.second;
+            }
+        }
+
+        // the key count, fields with duplicated values are one key
+        static constexpr size_type size() noexcept {
+            return detail::indexed_field_count<Enum>();
+        }
+
+        // the field should be declared (asserted), fields with duplicated
+        // values share the slot of the first declared one
+        constexpr T& operator[](Enum e) noexcept {
+            const std::size_t index = enum_hpp::to_index_or_invalid(e);
+            assert(index != invalid_index && "enum_hpp::enum_map::operator[]: undeclared key");
+            return data_[index];
+        }
+
+        constexpr const T& operator[](Enum e) const noexcept {
+            const std::size_t index = enum_hpp::to_index_or_invalid(e);
+            assert(index != invalid_index && "enum_hpp::enum_map::operator[]: undeclared key");
+            return data_[index];
+        }
+
+        // throws on values without a field
+        constexpr T& at(Enum e) {
+            return data_[checked_index(e)];
+        }
+
+        constexpr const T& at(Enum e) const {
+            return data_[checked_index(e)];
+        }
+
+        // end() for values without a field
+        constexpr iterator find(Enum e) noexcept {
+            const std::size_t index = enum_hpp::to_index_or_invalid(e);
+            return index != invalid_index ? iterator(data_.data(), index) : end();
+        }
+
+        constexpr const_iterator find(Enum e) const noexcept {
+            const std::size_t index = enum_hpp::to_index_or_invalid(e);
+            return index != invalid_index ? const_iterator(data_.data(), index) : end();
+        }
+
+        constexpr iterator begin() noexcept {
+            return iterator(data_.data(), 0);
+        }
+
+        constexpr const_iterator begin() const noexcept {
+            return const_iterator(data_.data(), 0);
+        }
+
+        constexpr const_iterator cbegin() const noexcept {
+            return begin();
+        }
+
+        constexpr iterator end() noexcept {
+            return iterator(data_.data(), enum_hpp::size<Enum>());
+        }
+
+        constexpr const_iterator end() const noexcept {
+            return const_iterator(data_.data(), enum_hpp::size<Enum>());
+        }
+
+        constexpr const_iterator cend() const noexcept {
+            return end();
+        }
+
+        // the values in declaration order of the fields, a field with
+        // the value of an earlier field has an unused slot
+        constexpr std::array<T, enum_hpp::size<Enum>()>& as_array() noexcept {
+            return data_;
+        }
+
+        constexpr const std::array<T, enum_hpp::size<Enum>()>& as_array() const noexcept {
+            return data_;
+        }
+
+        constexpr void fill(const T& value) {
+            for ( T& item : data_ ) {
+                item = value;
+            }
+        }
+
+        constexpr void swap(enum_map& other) noexcept(std::is_nothrow_swappable_v<T>) {
+            for ( std::size_t i = 0; i < data_.size(); ++i ) {
+                using std::swap;
+                swap(data_[i], other.data_[i]);
+            }
+        }
+    private:
+        static constexpr std::size_t checked_index(Enum e) {
+            const std::size_t index = enum_hpp::to_index_or_invalid(e);
+            if ( index == invalid_index ) {
+                detail::throw_exception_with("enum_hpp::enum_map::at(): invalid argument");
+            }
+            return index;
+        }
+    private:
+        std::array<T, enum_hpp::size<Enum>()> data_{};
+    };
+
+    template < typename Enum, typename T >
+    constexpr void swap(enum_map<Enum, T>& l, enum_map<Enum, T>& r) noexcept(noexcept(l.swap(r))) {
+        l.swap(r);
+    }
+
+    // compares the slots of the keys only
+    template < typename Enum, typename T >
+    constexpr bool operator==(const enum_map<Enum, T>& l, const enum_map<Enum, T>& r) {
+        for ( std::size_t i = 0; i < l.as_array().size(); ++i ) {
+            if ( detail::is_indexed_field<Enum>(i) && !(l.as_array()[i] == r.as_array()[i]) ) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template < typename Enum, typename T >
+    constexpr bool operator!=(const enum_map<Enum, T>& l, const enum_map<Enum, T>& r) {
+        return !(l == r);
+    }
+}
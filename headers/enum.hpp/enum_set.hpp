@@ -0,0 +1,283 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/enum.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2019-2023, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#pragma once
+
+//
+// enum_set<Enum>, one bit per field addressed by to_index,
+// for any enumeration, not only for bit mask values like bitflags
+//
+
+#include "enum_core.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+
+namespace enum_hpp
+{
+    template < typename Enum >
+    class enum_set final {
+        static_assert(std::is_enum_v<Enum>);
+    public:
+        using key_type = Enum;
+        using value_type = Enum;
+        using size_type = std::size_t;
+        using word_type = std::uint64_t;
+
+        static constexpr std::size_t word_bits = 64;
+        static constexpr std::size_t word_count = (enum_hpp::size<Enum>() + word_bits - 1) / word_bits;
+
+        // visits the members in declaration order, skips empty words
+        class const_iterator final {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using difference_type = std::ptrdiff_t;
+            using value_type = Enum;
+            using reference = Enum;
+            using pointer = void;
+
+            const_iterator() = default;
+
+            constexpr const_iterator(const word_type* words, std::size_t word) noexcept
+            : words_(words)
+            , word_(word) {
+                skip_empty_words();
+            }
+
+            constexpr reference operator*() const noexcept {
+                return enum_hpp::values<Enum>()[word_ * word_bits + detail::countr_zero(bits_)];
+            }
+
+            constexpr const_iterator& operator++() noexcept {
+                bits_ &= bits_ - 1;
+                if ( bits_ == 0 ) {
+                    ++word_;
+                    skip_empty_words();
+                }
+                return *this;
+            }
+
+            constexpr const_iterator operator++(int) noexcept {
+                const_iterator result = *this;
+                ++*this;
+                return result;
+            }
+
+            friend constexpr bool operator==(const const_iterator& l, const const_iterator& r) noexcept {
+                return l.word_ == r.word_ && l.bits_ == r.bits_;
+            }
+
+            friend constexpr bool operator!=(const const_iterator& l, const const_iterator& r) noexcept {
+                return !(l == r);
+            }
+        private:
+            constexpr void skip_empty_words() noexcept {
+                for ( ; word_ < word_count; ++word_ ) {
+                    if ( (bits_ = words_[word_]) != 0 ) {
+                        return;
+                    }
+                }
+            }
+        private:
+            const word_type* words_{};
+            std::size_t word_{};
+            word_type bits_{};
+        };
+
+        using iterator = const_iterator;
+
+        enum_set() = default;
+
+        // values without a field are skipped
+        constexpr enum_set(std::initializer_list<Enum> init) noexcept {
+            for ( const Enum e : init ) {
+                insert(e);
+            }
+        }
+
+        // every field, fields with duplicated values are one member
+        static constexpr enum_set all() noexcept {
+            enum_set result;
+            result.words_ = detail::indexed_field_words<Enum>;
+            return result;
+        }
+
+        static constexpr size_type max_size() noexcept {
+            return detail::indexed_field_count<Enum>();
+        }
+
+        constexpr bool empty() const noexcept {
+            for ( const word_type word : words_ ) {
+                if ( word != 0 ) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        constexpr size_type size() const noexcept {
+            size_type count = 0;
+            for ( const word_type word : words_ ) {
+                count += detail::popcount(word);
+            }
+            return count;
+        }
+
+        // false for values without a field
+        constexpr bool contains(Enum e) const noexcept {
+            const std::size_t index = enum_hpp::to_index_or_invalid(e);
+            return index != invalid_index
+                && (words_[index / word_bits] & bit_of(index)) != 0;
+        }
+
+        // returns true when the field is added
+        constexpr bool insert(Enum e) noexcept {
+            const std::size_t index = enum_hpp::to_index_or_invalid(e);
+            if ( index == invalid_index || (words_[index / word_bits] & bit_of(index)) != 0 ) {
+                return false;
+            }
+            words_[index / word_bits] |= bit_of(index);
+            return true;
+        }
+
+        // returns true when the field is removed
+        constexpr bool erase(Enum e) noexcept {
+            const std::size_t index = enum_hpp::to_index_or_invalid(e);
+            if ( index == invalid_index || (words_[index / word_bits] & bit_of(index)) == 0 ) {
+                return false;
+            }
+            words_[index / word_bits] &= ~bit_of(index);
+            return true;
+        }
+
+        constexpr void clear() noexcept {
+            for ( word_type& word : words_ ) {
+                word = 0;
+            }
+        }
+
+        // every field of other is in this set
+        constexpr bool includes(const enum_set& other) const noexcept {
+            for ( std::size_t i = 0; i < word_count; ++i ) {
+                if ( (other.words_[i] & ~words_[i]) != 0 ) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        // the sets have a common field
+        constexpr bool intersects(const enum_set& other) const noexcept {
+            for ( std::size_t i = 0; i < word_count; ++i ) {
+                if ( (other.words_[i] & words_[i]) != 0 ) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        constexpr const_iterator begin() const noexcept {
+            return const_iterator(words_.data(), 0);
+        }
+
+        constexpr const_iterator cbegin() const noexcept {
+            return begin();
+        }
+
+        constexpr const_iterator end() const noexcept {
+            return const_iterator(words_.data(), word_count);
+        }
+
+        constexpr const_iterator cend() const noexcept {
+            return end();
+        }
+
+        // bit i % word_bits of word i / word_bits is the field with index i
+        constexpr const std::array<word_type, word_count>& as_words() const noexcept {
+            return words_;
+        }
+
+        constexpr enum_set& operator|=(const enum_set& other) noexcept {
+            for ( std::size_t i = 0; i < word_count; ++i ) {
+                words_[i] |= other.words_[i];
+            }
+            return *this;
+        }
+
+        constexpr enum_set& operator&=(const enum_set& other) noexcept {
+            for ( std::size_t i = 0; i < word_count; ++i ) {
+                words_[i] &= other.words_[i];
+            }
+            return *this;
+        }
+
+        constexpr enum_set& operator^=(const enum_set& other) noexcept {
+            for ( std::size_t i = 0; i < word_count; ++i ) {
+                words_[i] ^= other.words_[i];
+            }
+            return *this;
+        }
+
+        constexpr enum_set& operator-=(const enum_set& other) noexcept {
+            for ( std::size_t i = 0; i < word_count; ++i ) {
+                words_[i] &= ~other.words_[i];
+            }
+            return *this;
+        }
+
+        constexpr enum_set operator~() const noexcept {
+            enum_set result;
+            for ( std::size_t i = 0; i < word_count; ++i ) {
+                result.words_[i] = ~words_[i] & detail::indexed_field_words<Enum>[i];
+            }
+            return result;
+        }
+
+        friend constexpr bool operator==(const enum_set& l, const enum_set& r) noexcept {
+            for ( std::size_t i = 0; i < word_count; ++i ) {
+                if ( l.words_[i] != r.words_[i] ) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        friend constexpr bool operator!=(const enum_set& l, const enum_set& r) noexcept {
+            return !(l == r);
+        }
+    private:
+        static constexpr word_type bit_of(std::size_t index) noexcept {
+            return word_type{1} << (index % word_bits);
+        }
+
+    private:
+        std::array<word_type, word_count> words_{};
+    };
+
+    template < typename Enum >
+    constexpr enum_set<Enum> operator|(enum_set<Enum> l, const enum_set<Enum>& r) noexcept {
+        return l |= r;
+    }
+
+    template < typename Enum >
+    constexpr enum_set<Enum> operator&(enum_set<Enum> l, const enum_set<Enum>& r) noexcept {
+        return l &= r;
+    }
+
+    template < typename Enum >
+    constexpr enum_set<Enum> operator^(enum_set<Enum> l, const enum_set<Enum>& r) noexcept {
+        return l ^= r;
+    }
+
+    template < typename Enum >
+    constexpr enum_set<Enum> operator-(enum_set<Enum> l, const enum_set<Enum>& r) noexcept {
+        return l -= r;
+    }
+}
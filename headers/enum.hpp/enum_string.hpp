@@ -0,0 +1,376 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/enum.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2019-2023, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#pragma once
+
+//
+// string conversion of registered traits
+//
+
+#include "enum_core.hpp"
+
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+
+namespace enum_hpp
+{
+    inline constexpr std::string_view empty_string = std::string_view();
+
+    enum class lookup_strategy : std::uint8_t {
+        linear,
+        binary_search,
+        perfect_hash,
+        trie,
+        hash_table,
+    };
+
+    constexpr std::string_view lookup_strategy_name(lookup_strategy strategy) noexcept {
+        switch ( strategy ) {
+            case lookup_strategy::linear: return "linear";
+            case lookup_strategy::binary_search: return "binary_search";
+            case lookup_strategy::perfect_hash: return "perfect_hash";
+            case lookup_strategy::trie: return "trie";
+            case lookup_strategy::hash_table: return "hash_table";
+            default: return empty_string;
+        }
+    }
+
+    template < typename Enum >
+    struct parse_result final {
+        const char* ptr{};
+        std::optional<Enum> value{};
+    };
+}
+
+namespace enum_hpp
+{
+    // specialize to override the automatically chosen string lookup of generic functions
+    template < typename Enum >
+    struct lookup_policy {
+        static constexpr lookup_strategy value = traits_t<Enum>::lookup;
+    };
+
+    template < typename Enum >
+    constexpr lookup_strategy lookup_strategy_of() noexcept {
+        return lookup_policy<Enum>::value;
+    }
+
+    template < typename Enum >
+    constexpr const std::array<std::string_view, size<Enum>()>& names() noexcept {
+        return traits_t<Enum>::template names<>;
+    }
+
+    template < typename Enum >
+    constexpr std::size_t max_name_length() noexcept {
+        return traits_t<Enum>::max_name_length;
+    }
+
+    template < typename Enum >
+    constexpr const std::array<const char*, size<Enum>()>& c_names() noexcept {
+        return traits_t<Enum>::template c_names<>;
+    }
+
+#if defined(ENUM_HPP_NO_NAMES)
+    // the name hash of the field, a host-side tool maps it back to the name
+    template < typename Enum >
+    constexpr std::optional<std::uint64_t> to_string(Enum e) noexcept {
+        return traits_t<Enum>::to_string(e);
+    }
+#else
+    template < typename Enum >
+    constexpr std::optional<std::string_view> to_string(Enum e) noexcept {
+        return traits_t<Enum>::to_string(e);
+    }
+
+    template < typename Enum >
+    constexpr std::string_view to_string_or_empty(Enum e) noexcept {
+        return traits_t<Enum>::to_string_or_empty(e);
+    }
+#endif
+
+    template < typename Enum >
+    constexpr const char* to_c_str(Enum e) noexcept {
+        return traits_t<Enum>::to_c_str(e);
+    }
+
+    template < typename Enum >
+    constexpr const char* to_c_str_or_empty(Enum e) noexcept {
+        return traits_t<Enum>::to_c_str_or_empty(e);
+    }
+
+    template < typename Enum >
+    constexpr std::optional<Enum> from_string(std::string_view name) noexcept {
+        if constexpr ( lookup_policy<Enum>::value == traits_t<Enum>::lookup ) {
+            return traits_t<Enum>::from_string(name);
+        } else {
+            return traits_t<Enum>::template from_string_with<lookup_policy<Enum>::value>(name);
+        }
+    }
+
+    template < typename Enum >
+    constexpr Enum from_string_or_default(std::string_view name, Enum def) noexcept {
+        if ( auto e = from_string<Enum>(name) ) {
+            return *e;
+        }
+        return def;
+    }
+
+    template < typename Enum, lookup_strategy Strategy >
+    constexpr std::optional<Enum> from_string_with(std::string_view name) noexcept {
+        return traits_t<Enum>::template from_string_with<Strategy>(name);
+    }
+
+    template < typename Enum >
+    constexpr parse_result<Enum> parse_prefix(const char* first, const char* last, std::string_view delimiters = {}) noexcept {
+        if constexpr ( lookup_policy<Enum>::value == traits_t<Enum>::lookup ) {
+            return traits_t<Enum>::parse_prefix(first, last, delimiters);
+        } else {
+            return traits_t<Enum>::template parse_prefix_with<lookup_policy<Enum>::value>(first, last, delimiters);
+        }
+    }
+
+    template < typename Enum >
+    constexpr std::size_t from_strings(const std::string_view* strings, std::size_t count, Enum* values, bool* found = nullptr) noexcept {
+        if constexpr ( lookup_policy<Enum>::value == traits_t<Enum>::lookup ) {
+            return traits_t<Enum>::from_strings(strings, count, values, found);
+        } else {
+            return traits_t<Enum>::template from_strings_with<lookup_policy<Enum>::value>(strings, count, values, found);
+        }
+    }
+
+    template < typename Enum >
+    constexpr std::optional<Enum> from_string_icase(std::string_view name) noexcept {
+        if constexpr ( lookup_policy<Enum>::value == traits_t<Enum>::lookup ) {
+            return traits_t<Enum>::from_string_icase(name);
+        } else {
+            return traits_t<Enum>::template from_string_icase_with<lookup_policy<Enum>::value>(name);
+        }
+    }
+
+    template < typename Enum >
+    constexpr Enum from_string_icase_or_default(std::string_view name, Enum def) noexcept {
+        if ( auto e = from_string_icase<Enum>(name) ) {
+            return *e;
+        }
+        return def;
+    }
+}
+
+namespace enum_hpp::detail
+{
+    struct identity_fold final {
+        constexpr char operator()(char ch) const noexcept {
+            return ch;
+        }
+    };
+
+    struct ascii_lower_fold final {
+        constexpr char operator()(char ch) const noexcept {
+            return ch >= 'A' && ch <= 'Z'
+                ? static_cast<char>(ch - 'A' + 'a')
+                : ch;
+        }
+    };
+
+    constexpr bool is_space(char ch) noexcept {
+        switch ( ch ) {
+            case ' ':
+            case '\r':
+            case '\n':
+            case '\t':
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    constexpr std::string_view trim_spaces(std::string_view str) noexcept {
+        while ( !str.empty() && is_space(str.front()) ) {
+            str.remove_prefix(1);
+        }
+        while ( !str.empty() && is_space(str.back()) ) {
+            str.remove_suffix(1);
+        }
+        return str;
+    }
+
+    template < std::size_t Size >
+    constexpr std::size_t total_name_length(const std::array<std::string_view, Size>& names) noexcept {
+        std::size_t length = 0;
+        for ( const std::string_view name : names ) {
+            length += name.size();
+        }
+        return length;
+    }
+
+    // FNV-1a
+    inline constexpr std::uint64_t hash_name_basis = 0xcbf29ce484222325u;
+
+    constexpr std::uint64_t hash_name_step(std::uint64_t h, char ch) noexcept {
+        return (h ^ static_cast<unsigned char>(ch)) * 0x100000001b3u;
+    }
+
+    template < typename Fold = identity_fold >
+    constexpr std::uint64_t hash_name(std::string_view name, Fold fold = Fold{}) noexcept {
+        std::uint64_t h = hash_name_basis;
+        for ( const char ch : name ) {
+            h = hash_name_step(h, fold(ch));
+        }
+        return h;
+    }
+
+    template < typename T >
+    constexpr std::size_t max_integer_chars() noexcept {
+        return static_cast<std::size_t>(std::numeric_limits<T>::digits10) + 1
+            + (std::numeric_limits<T>::is_signed ? 1 : 0);
+    }
+
+    inline std::to_chars_result write_chars(char* first, char* last, std::string_view str) noexcept {
+        if ( static_cast<std::size_t>(last - first) < str.size() ) {
+            return {last, std::errc::value_too_large};
+        }
+        for ( const char ch : str ) {
+            *first++ = ch;
+        }
+        return {first, std::errc{}};
+    }
+
+    // "#" and the 16 hex digits of a name hash
+    inline constexpr std::size_t name_token_length = 17;
+
+    inline std::to_chars_result write_name(char* first, char* last, std::uint64_t hash) noexcept {
+        if ( static_cast<std::size_t>(last - first) < name_token_length ) {
+            return {last, std::errc::value_too_large};
+        }
+        *first++ = '#';
+        for ( std::size_t i = name_token_length - 1; i > 0; --i ) {
+            *first++ = "0123456789abcdef"[(hash >> ((i - 1) * 4)) & 0xFu];
+        }
+        return {first, std::errc{}};
+    }
+
+    inline std::to_chars_result write_name(char* first, char* last, std::string_view name) noexcept {
+        return write_chars(first, last, name);
+    }
+
+#if defined(ENUM_HPP_NO_NAMES)
+    // "17", there is no type name to write
+    template < typename Enum >
+    constexpr std::size_t max_unknown_enum_chars() noexcept {
+        return max_integer_chars<std::underlying_type_t<Enum>>();
+    }
+
+    template < typename Enum >
+    std::to_chars_result write_unknown_enum(char* first, char* last, std::underlying_type_t<Enum> value) noexcept {
+        return std::to_chars(first, last, value);
+    }
+#else
+    // "Enum(17)"
+    template < typename Enum >
+    constexpr std::size_t max_unknown_enum_chars() noexcept {
+        return traits_t<Enum>::type_name.size() + 2
+            + max_integer_chars<std::underlying_type_t<Enum>>();
+    }
+
+    template < typename Enum >
+    std::to_chars_result write_unknown_enum(char* first, char* last, std::underlying_type_t<Enum> value) noexcept {
+        std::to_chars_result result = write_chars(first, last, traits_t<Enum>::type_name);
+        if ( result.ec == std::errc{} ) {
+            result = write_chars(result.ptr, last, "(");
+        }
+        if ( result.ec == std::errc{} ) {
+            result = std::to_chars(result.ptr, last, value);
+        }
+        if ( result.ec == std::errc{} ) {
+            result = write_chars(result.ptr, last, ")");
+        }
+        return result;
+    }
+#endif
+}
+
+namespace enum_hpp
+{
+    // the longest to_chars output, a field name or the "Enum(value)" fallback
+    template < typename Enum >
+    constexpr std::size_t max_chars_length() noexcept {
+    #if defined(ENUM_HPP_NO_NAMES)
+        constexpr std::size_t name_length = detail::name_token_length;
+    #else
+        constexpr std::size_t name_length = max_name_length<Enum>();
+    #endif
+        constexpr std::size_t unknown_length = detail::max_unknown_enum_chars<Enum>();
+        return name_length > unknown_length
+            ? name_length
+            : unknown_length;
+    }
+
+    // writes the field name or "Enum(value)" for unknown values,
+    // "#<name hash>" or "value" with ENUM_HPP_NO_NAMES
+    template < typename Enum >
+    std::to_chars_result to_chars(char* first, char* last, Enum e) noexcept {
+        if ( auto name = traits_t<Enum>::to_string(e) ) {
+            return detail::write_name(first, last, *name);
+        }
+        return detail::write_unknown_enum<Enum>(first, last, to_underlying(e));
+    }
+
+    // 64-bit FNV-1a of the name bytes, the hash of `name_hashes`
+    constexpr std::uint64_t hash_name(std::string_view name) noexcept {
+        return detail::hash_name(name);
+    }
+}
+
+namespace enum_hpp::detail
+{
+    // not constexpr, so a call from a constant expression fails the build
+    inline void unknown_enum_name() noexcept {}
+
+    template < typename Enum >
+    constexpr Enum value_of_or_fail(std::optional<Enum> e) noexcept {
+        if ( !e ) {
+            unknown_enum_name();
+        }
+        return *e;
+    }
+}
+
+#if defined(__cpp_nontype_template_args) && __cpp_nontype_template_args >= 201911L
+namespace enum_hpp
+{
+    template < std::size_t Size >
+    struct fixed_name final {
+        std::array<char, Size> chars{};
+
+        // NOLINTNEXTLINE(*-avoid-c-arrays, *-explicit-conversions)
+        constexpr fixed_name(const char (&str)[Size]) noexcept {
+            for ( std::size_t i = 0; i < Size; ++i ) {
+                chars[i] = str[i];
+            }
+        }
+
+        constexpr std::string_view view() const noexcept {
+            return std::string_view(chars.data(), Size - 1);
+        }
+    };
+
+    template < typename Enum, fixed_name Name >
+    inline constexpr Enum value_of = detail::value_of_or_fail(from_string<Enum>(Name.view()));
+}
+#endif
+
+//
+// ENUM_HPP_VALUE_OF
+//
+
+#define ENUM_HPP_VALUE_OF(Enum, Name)\
+    (std::integral_constant<Enum, ::enum_hpp::detail::value_of_or_fail(::enum_hpp::from_string<Enum>(Name))>::value)
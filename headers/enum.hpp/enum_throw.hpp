@@ -0,0 +1,124 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/enum.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2019-2023, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#pragma once
+
+//
+// the functions throwing enum_hpp::exception on invalid arguments,
+// std::abort is called instead when exceptions are disabled
+//
+
+#include "enum_string.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <stdexcept>
+#include <string_view>
+
+#if !defined(__cpp_exceptions) && !defined(__EXCEPTIONS) && !defined(_CPPUNWIND)
+#  define ENUM_HPP_NO_EXCEPTIONS
+#endif
+
+namespace enum_hpp
+{
+    class exception final : public std::runtime_error {
+    public:
+        explicit exception(const char* what)
+        : std::runtime_error(what) {}
+    };
+}
+
+namespace enum_hpp::detail
+{
+    inline void throw_exception_with [[noreturn]] (const char* what) {
+    #ifndef ENUM_HPP_NO_EXCEPTIONS
+        throw ::enum_hpp::exception(what);
+    #else
+        (void)what;
+        std::abort();
+    #endif
+    }
+}
+
+namespace enum_hpp
+{
+    template < typename Enum >
+    Enum from_underlying_or_throw(underlying_type<Enum> value) {
+        return traits_t<Enum>::from_underlying_or_throw(value);
+    }
+
+#if defined(ENUM_HPP_NO_NAMES)
+    template < typename Enum >
+    std::uint64_t to_string_or_throw(Enum e) {
+        return traits_t<Enum>::to_string_or_throw(e);
+    }
+#else
+    template < typename Enum >
+    std::string_view to_string_or_throw(Enum e) {
+        return traits_t<Enum>::to_string_or_throw(e);
+    }
+#endif
+
+    template < typename Enum >
+    const char* to_c_str_or_throw(Enum e) {
+        return traits_t<Enum>::to_c_str_or_throw(e);
+    }
+
+    // one lookup with the lookup_policy strategy, a miss throws
+    // the exception of the traits function with the traits name
+    template < typename Enum >
+    Enum from_string_or_throw(std::string_view name) {
+        if constexpr ( lookup_policy<Enum>::value == traits_t<Enum>::lookup ) {
+            return traits_t<Enum>::from_string_or_throw(name);
+        } else {
+            if ( auto e = from_string<Enum>(name) ) {
+                return *e;
+            }
+            traits_t<Enum>::template throw_invalid_name<false>();
+        }
+    }
+
+    template < typename Enum >
+    Enum from_string_icase_or_throw(std::string_view name) {
+        if constexpr ( lookup_policy<Enum>::value == traits_t<Enum>::lookup ) {
+            return traits_t<Enum>::from_string_icase_or_throw(name);
+        } else {
+            if ( auto e = from_string_icase<Enum>(name) ) {
+                return *e;
+            }
+            traits_t<Enum>::template throw_invalid_name<true>();
+        }
+    }
+
+    template < typename Enum >
+    Enum from_name_hash_or_throw(std::uint64_t hash) {
+        return traits_t<Enum>::from_name_hash_or_throw(hash);
+    }
+
+    template < typename Enum >
+    std::size_t to_index_or_throw(Enum e) {
+        return traits_t<Enum>::to_index_or_throw(e);
+    }
+
+    template < typename Enum >
+    Enum from_index_or_throw(std::size_t index) {
+        return traits_t<Enum>::from_index_or_throw(index);
+    }
+}
+
+//
+// ENUM_HPP_TRAITS_ERROR
+//
+// without names the messages are the same for all enumerations,
+// so only one copy of each is left in the binary
+//
+
+#if defined(ENUM_HPP_NO_NAMES)
+#  define ENUM_HPP_TRAITS_ERROR(Enum, Function) "enum_hpp::" #Function "(): invalid argument"
+#else
+#  define ENUM_HPP_TRAITS_ERROR(Enum, Function) #Enum "_traits::" #Function "(): invalid argument"
+#endif
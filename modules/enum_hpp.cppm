@@ -0,0 +1,47 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/enum.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2019-2023, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+//
+// import enum_hpp;
+//
+// exports the whole library except the macros, which can't be exported.
+// the headers are included into `extern "C++"`, so the entities stay in
+// the global module and are the same as the ones of the included headers.
+//
+// experimental: units declaring enumerations include enum_decl.hpp too,
+// which needs a compiler merging the header entities with the module ones,
+// g++ 12 doesn't.
+//
+
+module;
+
+// every standard header of the library, so they are not included
+// into the module purview below
+#include <array>
+#include <cassert>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+export module enum_hpp;
+
+export extern "C++" {
+#include <enum.hpp/enum.hpp>
+#include <enum.hpp/enum_bitflags.hpp>
+#include <enum.hpp/enum_map.hpp>
+#include <enum.hpp/enum_set.hpp>
+}
@@ -0,0 +1,1015 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/enum.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2019-2023, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+//
+// enum_gen <input> <output>
+//
+// reads an enum description and writes a header with the enumeration and its
+// traits, every lookup table is computed here and written out as literals:
+//
+//   # comments start with '#'
+//   namespace some_namespace
+//   enum class color : unsigned
+//
+//   red = 2
+//   green          # the previous value + 1
+//   blue = 0x8 navy # navy is an alias of blue
+//
+// the namespace line is optional, the values are integer literals
+//
+
+#include <enum.hpp/enum.hpp>
+
+#include <algorithm>
+#include <charconv>
+#include <climits>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+    struct underlying_info final {
+        bool is_signed{};
+        unsigned bits{};
+    };
+
+    struct field final {
+        std::string name;
+        std::vector<std::string> aliases;
+        std::uint64_t value{};
+    };
+
+    struct description final {
+        std::string ns;
+        bool scoped{};
+        std::string name;
+        std::string type;
+        underlying_info info{};
+        std::vector<field> fields;
+    };
+
+    class parse_error final : public std::runtime_error {
+    public:
+        parse_error(std::size_t line, const std::string& what)
+        : std::runtime_error(what)
+        , line_(line) {}
+
+        std::size_t line() const noexcept {
+            return line_;
+        }
+    private:
+        std::size_t line_{};
+    };
+
+    //
+    // parsing
+    //
+
+    std::optional<underlying_info> find_underlying_info(std::string_view type) {
+        static const std::map<std::string_view, underlying_info> infos{
+            {"signed char", {true, 8}},
+            {"unsigned char", {false, 8}},
+            {"short", {true, 16}},
+            {"short int", {true, 16}},
+            {"unsigned short", {false, 16}},
+            {"unsigned short int", {false, 16}},
+            {"int", {true, 32}},
+            {"signed", {true, 32}},
+            {"signed int", {true, 32}},
+            {"unsigned", {false, 32}},
+            {"unsigned int", {false, 32}},
+            {"long", {true, sizeof(long) * CHAR_BIT}},
+            {"long int", {true, sizeof(long) * CHAR_BIT}},
+            {"unsigned long", {false, sizeof(long) * CHAR_BIT}},
+            {"unsigned long int", {false, sizeof(long) * CHAR_BIT}},
+            {"long long", {true, 64}},
+            {"long long int", {true, 64}},
+            {"unsigned long long", {false, 64}},
+            {"unsigned long long int", {false, 64}},
+            {"std::int8_t", {true, 8}},
+            {"std::uint8_t", {false, 8}},
+            {"std::int16_t", {true, 16}},
+            {"std::uint16_t", {false, 16}},
+            {"std::int32_t", {true, 32}},
+            {"std::uint32_t", {false, 32}},
+            {"std::int64_t", {true, 64}},
+            {"std::uint64_t", {false, 64}},
+        };
+        if ( const auto iter = infos.find(type); iter != infos.end() ) {
+            return iter->second;
+        }
+        return std::nullopt;
+    }
+
+    std::string_view trim(std::string_view str) noexcept {
+        const std::size_t first = str.find_first_not_of(" \t\r");
+        if ( first == std::string_view::npos ) {
+            return {};
+        }
+        const std::size_t last = str.find_last_not_of(" \t\r");
+        return str.substr(first, last - first + 1);
+    }
+
+    std::vector<std::string_view> split_words(std::string_view str) {
+        std::vector<std::string_view> words;
+        while ( !(str = trim(str)).empty() ) {
+            const std::size_t end = std::min(str.find_first_of(" \t\r"), str.size());
+            words.push_back(str.substr(0, end));
+            str.remove_prefix(end);
+        }
+        return words;
+    }
+
+    bool is_identifier(std::string_view str) noexcept {
+        const auto is_alpha = [](char ch) noexcept {
+            return (ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z') || ch == '_';
+        };
+        const auto is_digit = [](char ch) noexcept {
+            return ch >= '0' && ch <= '9';
+        };
+        if ( str.empty() || !is_alpha(str.front()) ) {
+            return false;
+        }
+        return std::all_of(str.begin(), str.end(), [&](char ch){
+            return is_alpha(ch) || is_digit(ch);
+        });
+    }
+
+    bool is_qualified_identifier(std::string_view str) noexcept {
+        while ( true ) {
+            const std::size_t sep = str.find("::");
+            if ( !is_identifier(str.substr(0, sep)) ) {
+                return false;
+            }
+            if ( sep == std::string_view::npos ) {
+                return true;
+            }
+            str.remove_prefix(sep + 2);
+        }
+    }
+
+    // two's complement bits of the value, checked against the underlying type
+    std::optional<std::uint64_t> parse_value(std::string_view str, const underlying_info& info) noexcept {
+        const bool negative = !str.empty() && str.front() == '-';
+        if ( negative ) {
+            str.remove_prefix(1);
+        }
+
+        int base = 10;
+        if ( str.size() > 2 && str[0] == '0' && (str[1] == 'x' || str[1] == 'X') ) {
+            base = 16;
+            str.remove_prefix(2);
+        } else if ( str.size() > 2 && str[0] == '0' && (str[1] == 'b' || str[1] == 'B') ) {
+            base = 2;
+            str.remove_prefix(2);
+        }
+
+        std::uint64_t magnitude{};
+        const auto [ptr, ec] = std::from_chars(str.data(), str.data() + str.size(), magnitude, base);
+        if ( str.empty() || ec != std::errc{} || ptr != str.data() + str.size() ) {
+            return std::nullopt;
+        }
+
+        if ( info.is_signed ) {
+            const std::uint64_t max_magnitude = std::uint64_t(1) << (info.bits - 1);
+            if ( magnitude > max_magnitude || (!negative && magnitude == max_magnitude) ) {
+                return std::nullopt;
+            }
+            return negative ? std::uint64_t(0) - magnitude : magnitude;
+        }
+
+        if ( negative || (info.bits < 64 && magnitude >> info.bits) ) {
+            return std::nullopt;
+        }
+        return magnitude;
+    }
+
+    bool is_max_value(std::uint64_t value, const underlying_info& info) noexcept {
+        const std::uint64_t max = info.is_signed
+            ? (std::uint64_t(1) << (info.bits - 1)) - 1
+            : (info.bits < 64 ? (std::uint64_t(1) << info.bits) - 1 : ~std::uint64_t(0));
+        return value == max;
+    }
+
+    void parse_header(description& desc, std::size_t line, std::string_view str) {
+        const std::size_t colon = str.find(':');
+        if ( colon == std::string_view::npos || (colon + 1 < str.size() && str[colon + 1] == ':') ) {
+            throw parse_error(line, "expected 'enum [class] <name> : <underlying type>'");
+        }
+
+        const std::vector<std::string_view> words = split_words(str.substr(0, colon));
+        const bool scoped = words.size() == 3 && (words[1] == "class" || words[1] == "struct");
+        if ( !(words.size() == 2 || scoped) || words[0] != "enum" || !is_identifier(words.back()) ) {
+            throw parse_error(line, "expected 'enum [class] <name> : <underlying type>'");
+        }
+
+        std::string type;
+        for ( const std::string_view word : split_words(str.substr(colon + 1)) ) {
+            type += type.empty() ? "" : " ";
+            type += word;
+        }
+
+        const std::optional<underlying_info> info = find_underlying_info(type);
+        if ( !info ) {
+            throw parse_error(line, "unsupported underlying type '" + type + "'");
+        }
+
+        desc.scoped = scoped;
+        desc.name = std::string(words.back());
+        desc.type = type;
+        desc.info = *info;
+    }
+
+    void parse_field(description& desc, std::size_t line, std::string_view str) {
+        field f;
+
+        const std::size_t assign = str.find('=');
+        std::vector<std::string_view> words = split_words(str.substr(0, assign));
+        if ( words.empty() || !is_identifier(words[0]) ) {
+            throw parse_error(line, "expected '<name> [= <value>] [aliases...]'");
+        }
+        f.name = std::string(words[0]);
+
+        if ( assign != std::string_view::npos ) {
+            if ( words.size() != 1 ) {
+                throw parse_error(line, "expected '<name> [= <value>] [aliases...]'");
+            }
+            words = split_words(str.substr(assign + 1));
+            if ( words.empty() ) {
+                throw parse_error(line, "expected a value of '" + f.name + "'");
+            }
+            const std::optional<std::uint64_t> value = parse_value(words[0], desc.info);
+            if ( !value ) {
+                throw parse_error(line, "'" + std::string(words[0]) + "' is not an integer literal of '" + desc.type + "'");
+            }
+            f.value = *value;
+        } else if ( !desc.fields.empty() ) {
+            if ( is_max_value(desc.fields.back().value, desc.info) ) {
+                throw parse_error(line, "the value of '" + f.name + "' overflows '" + desc.type + "'");
+            }
+            f.value = desc.fields.back().value + 1;
+        }
+
+        for ( std::size_t i = 1; i < words.size(); ++i ) {
+            if ( !is_identifier(words[i]) ) {
+                throw parse_error(line, "'" + std::string(words[i]) + "' is not an alias name");
+            }
+            f.aliases.emplace_back(words[i]);
+        }
+
+        desc.fields.push_back(std::move(f));
+    }
+
+    description parse_description(std::istream& in) {
+        description desc;
+
+        std::size_t line = 0;
+        for ( std::string text; std::getline(in, text); ) {
+            ++line;
+            std::string_view str = text;
+            str = trim(str.substr(0, str.find('#')));
+            if ( str.empty() ) {
+                continue;
+            }
+
+            if ( desc.name.empty() && str.substr(0, 10) == "namespace " ) {
+                desc.ns = std::string(trim(str.substr(10)));
+                if ( !is_qualified_identifier(desc.ns) ) {
+                    throw parse_error(line, "'" + desc.ns + "' is not a namespace name");
+                }
+            } else if ( desc.name.empty() ) {
+                parse_header(desc, line, str);
+            } else {
+                parse_field(desc, line, str);
+            }
+        }
+
+        if ( desc.name.empty() ) {
+            throw parse_error(line, "expected 'enum [class] <name> : <underlying type>'");
+        }
+
+        if ( desc.fields.empty() ) {
+            throw parse_error(line, "'" + desc.name + "' has no fields");
+        }
+
+        return desc;
+    }
+
+    //
+    // tables
+    //
+
+    struct tables final {
+        // field names, then aliases
+        std::vector<std::string_view> lookup_names;
+        std::vector<std::size_t> lookup_fields;
+        std::vector<std::uint64_t> name_hashes;
+
+        // open addressing by name hash, a lookup index + 1 per slot, 0 for empty slots
+        std::vector<std::size_t> lookup_slots;
+        std::vector<std::size_t> icase_lookup_slots;
+
+        std::uint64_t min_value{};
+        std::uint64_t max_value{};
+        bool is_contiguous{};
+        bool is_single_bit{};
+
+        // a field index + 1 per value in [min_value, max_value], 0 for holes
+        std::vector<std::size_t> values_index;
+
+        // otherwise the sorted distinct values and their first field indices
+        std::vector<std::uint64_t> sorted_values;
+        std::vector<std::size_t> sorted_indices;
+    };
+
+    bool value_less(std::uint64_t l, std::uint64_t r, const underlying_info& info) noexcept {
+        return info.is_signed
+            ? static_cast<std::int64_t>(l) < static_cast<std::int64_t>(r)
+            : l < r;
+    }
+
+    std::string lower_name(std::string_view name) {
+        std::string lower(name);
+        std::transform(lower.begin(), lower.end(), lower.begin(), enum_hpp::detail::ascii_lower_fold{});
+        return lower;
+    }
+
+    std::vector<std::size_t> make_slots(
+        const std::vector<std::string_view>& names,
+        const std::vector<bool>& included,
+        bool icase)
+    {
+        std::size_t slot_count = 2;
+        while ( slot_count < names.size() * 2 ) {
+            slot_count *= 2;
+        }
+
+        std::vector<std::size_t> slots(slot_count);
+        for ( std::size_t i = 0; i < names.size(); ++i ) {
+            if ( !included[i] ) {
+                continue;
+            }
+            const std::uint64_t hash = icase
+                ? enum_hpp::detail::hash_name(names[i], enum_hpp::detail::ascii_lower_fold{})
+                : enum_hpp::detail::hash_name(names[i]);
+            std::size_t slot = static_cast<std::size_t>(hash & (slot_count - 1));
+            while ( slots[slot] != 0 ) {
+                slot = (slot + 1) & (slot_count - 1);
+            }
+            slots[slot] = i + 1;
+        }
+        return slots;
+    }
+
+    tables make_tables(const description& desc) {
+        const underlying_info& info = desc.info;
+        tables t;
+
+        std::map<std::string_view, std::size_t> lookup_lines;
+        const auto add_lookup_name = [&](std::string_view name, std::size_t index){
+            if ( !lookup_lines.emplace(name, index).second ) {
+                throw std::runtime_error("duplicated field name '" + std::string(name) + "'");
+            }
+            t.lookup_names.push_back(name);
+            t.lookup_fields.push_back(index);
+        };
+
+        for ( std::size_t i = 0; i < desc.fields.size(); ++i ) {
+            add_lookup_name(desc.fields[i].name, i);
+            t.name_hashes.push_back(enum_hpp::hash_name(desc.fields[i].name));
+        }
+
+        for ( std::size_t i = 0; i < desc.fields.size(); ++i ) {
+            for ( const std::string& alias : desc.fields[i].aliases ) {
+                add_lookup_name(alias, i);
+            }
+        }
+
+        std::map<std::uint64_t, std::string_view> hashes;
+        for ( std::size_t i = 0; i < desc.fields.size(); ++i ) {
+            if ( const auto [iter, ok] = hashes.emplace(t.name_hashes[i], desc.fields[i].name); !ok ) {
+                throw std::runtime_error("field name hash collision of '"
+                    + std::string(iter->second) + "' and '" + desc.fields[i].name + "'");
+            }
+        }
+
+        // the first declared name wins when names differ only in case
+        std::vector<bool> icase_included(t.lookup_names.size());
+        std::map<std::string, std::size_t> lower_names;
+        for ( std::size_t i = 0; i < t.lookup_names.size(); ++i ) {
+            icase_included[i] = lower_names.emplace(lower_name(t.lookup_names[i]), i).second;
+        }
+
+        t.lookup_slots = make_slots(t.lookup_names, std::vector<bool>(t.lookup_names.size(), true), false);
+        t.icase_lookup_slots = make_slots(t.lookup_names, icase_included, true);
+
+        t.min_value = desc.fields.front().value;
+        t.max_value = desc.fields.front().value;
+        for ( const field& f : desc.fields ) {
+            t.min_value = value_less(f.value, t.min_value, info) ? f.value : t.min_value;
+            t.max_value = value_less(t.max_value, f.value, info) ? f.value : t.max_value;
+        }
+
+        const std::uint64_t width_mask = info.bits < 64
+            ? (std::uint64_t(1) << info.bits) - 1
+            : ~std::uint64_t(0);
+
+        std::uint64_t seen_bits{};
+        bool seen_zero = false;
+        t.is_single_bit = true;
+        for ( const field& f : desc.fields ) {
+            const std::uint64_t bits = f.value & width_mask;
+            if ( bits == 0 ) {
+                t.is_single_bit = t.is_single_bit && !seen_zero;
+                seen_zero = true;
+            } else {
+                t.is_single_bit = t.is_single_bit && (bits & (bits - 1)) == 0 && (seen_bits & bits) == 0;
+                seen_bits |= bits;
+            }
+        }
+
+        std::map<std::uint64_t, std::size_t> first_fields;
+        for ( std::size_t i = 0; i < desc.fields.size(); ++i ) {
+            first_fields.emplace(desc.fields[i].value, i);
+        }
+
+        // the same rule as the declaration macros, at most four slots per field
+        const std::uint64_t last_offset = (t.max_value - t.min_value) & width_mask;
+        t.is_contiguous = last_offset + 1 == first_fields.size();
+
+        if ( last_offset < desc.fields.size() * 4 ) {
+            t.values_index.resize(static_cast<std::size_t>(last_offset + 1));
+            for ( const auto& [value, index] : first_fields ) {
+                t.values_index[static_cast<std::size_t>((value - t.min_value) & width_mask)] = index + 1;
+            }
+        } else {
+            for ( const auto& [value, index] : first_fields ) {
+                t.sorted_values.push_back(value);
+                t.sorted_indices.push_back(index);
+            }
+            std::vector<std::size_t> order(t.sorted_values.size());
+            for ( std::size_t i = 0; i < order.size(); ++i ) {
+                order[i] = i;
+            }
+            std::sort(order.begin(), order.end(), [&](std::size_t l, std::size_t r){
+                return value_less(t.sorted_values[l], t.sorted_values[r], info);
+            });
+            std::vector<std::uint64_t> sorted_values;
+            std::vector<std::size_t> sorted_indices;
+            for ( const std::size_t i : order ) {
+                sorted_values.push_back(t.sorted_values[i]);
+                sorted_indices.push_back(t.sorted_indices[i]);
+            }
+            t.sorted_values = std::move(sorted_values);
+            t.sorted_indices = std::move(sorted_indices);
+        }
+
+        return t;
+    }
+
+    //
+    // writing
+    //
+
+    std::string value_literal(std::uint64_t value, const underlying_info& info) {
+        if ( !info.is_signed ) {
+            return std::to_string(value) + "u";
+        }
+        const auto signed_value = static_cast<std::int64_t>(value);
+        if ( signed_value == INT64_MIN ) {
+            return "(-9223372036854775807 - 1)";
+        }
+        return std::to_string(signed_value);
+    }
+
+    std::string hash_literal(std::uint64_t hash) {
+        std::ostringstream out;
+        out << "0x" << std::hex;
+        out.width(16);
+        out.fill('0');
+        out << hash << "u";
+        return out.str();
+    }
+
+    std::string index_type(std::size_t max_index) {
+        return max_index < 0xFFFFu ? "std::uint16_t" : "std::uint32_t";
+    }
+
+    template < typename T, typename F >
+    void write_array(std::ostream& out, const std::string& type, const std::string& name, const std::vector<T>& items, F&& write_item, std::size_t per_line = 1) {
+        out << "        static constexpr const std::array<" << type << ", " << items.size() << "> " << name << " = {{";
+        for ( std::size_t i = 0; i < items.size(); ++i ) {
+            out << (i % per_line == 0 ? "\n            " : " ");
+            write_item(items[i]);
+            out << ",";
+        }
+        out << "\n        }};\n";
+    }
+
+    void replace_all(std::string& str, std::string_view from, std::string_view to) {
+        for ( std::size_t pos = 0; (pos = str.find(from, pos)) != std::string::npos; pos += to.size() ) {
+            str.replace(pos, from.size(), to);
+        }
+    }
+
+    // the functions of every generated traits, `Enum` is replaced by the enumeration name
+    constexpr std::string_view functions_text = R"(    public:
+        [[maybe_unused]] static constexpr underlying_type to_underlying(enum_type e) noexcept {
+            return static_cast<underlying_type>(e);
+        }
+        [[maybe_unused]] static constexpr std::optional<enum_type> from_underlying(underlying_type value) noexcept {
+            if ( find_value(value) != ::enum_hpp::invalid_index ) {
+                return static_cast<enum_type>(value);
+            }
+            return std::nullopt;
+        }
+        [[maybe_unused]] static constexpr enum_type from_underlying_or_default(underlying_type value, enum_type def) noexcept {
+            if ( auto e = from_underlying(value) ) {
+                return *e;
+            }
+            return def;
+        }
+        [[maybe_unused]] static enum_type from_underlying_or_throw(underlying_type value) {
+            if ( auto e = from_underlying(value) ) {
+                return *e;
+            }
+            ::enum_hpp::detail::throw_exception_with(ENUM_HPP_TRAITS_ERROR(Enum, from_underlying_or_throw));
+        }
+        [[maybe_unused]] static constexpr std::size_t validate(const underlying_type* data, std::size_t count) noexcept {
+            for ( std::size_t i = 0; i < count; ++i ) {
+                if ( find_value(data[i]) == ::enum_hpp::invalid_index ) {
+                    return i;
+                }
+            }
+            return ::enum_hpp::invalid_index;
+        }
+#if defined(ENUM_HPP_NO_NAMES)
+        [[maybe_unused]] static constexpr std::optional<std::uint64_t> to_string(enum_type e) noexcept {
+            if ( const std::size_t i = find_value(to_underlying(e)); i != ::enum_hpp::invalid_index ) {
+                return name_hashes[i];
+            }
+            return std::nullopt;
+        }
+        [[maybe_unused]] static std::uint64_t to_string_or_throw(enum_type e) {
+            if ( auto s = to_string(e) ) {
+                return *s;
+            }
+            ::enum_hpp::detail::throw_exception_with(ENUM_HPP_TRAITS_ERROR(Enum, to_string_or_throw));
+        }
+#else
+        [[maybe_unused]] static constexpr std::optional<std::string_view> to_string(enum_type e) noexcept {
+            if ( const std::size_t i = find_value(to_underlying(e)); i != ::enum_hpp::invalid_index ) {
+                return names<>[i];
+            }
+            return std::nullopt;
+        }
+        [[maybe_unused]] static constexpr std::string_view to_string_or_empty(enum_type e) noexcept {
+            if ( auto s = to_string(e) ) {
+                return *s;
+            }
+            return ::enum_hpp::empty_string;
+        }
+        [[maybe_unused]] static std::string_view to_string_or_throw(enum_type e) {
+            if ( auto s = to_string(e) ) {
+                return *s;
+            }
+            ::enum_hpp::detail::throw_exception_with(ENUM_HPP_TRAITS_ERROR(Enum, to_string_or_throw));
+        }
+        [[maybe_unused]] static constexpr const char* to_c_str(enum_type e) noexcept {
+            if ( const std::size_t i = find_value(to_underlying(e)); i != ::enum_hpp::invalid_index ) {
+                return c_names<>[i];
+            }
+            return nullptr;
+        }
+        [[maybe_unused]] static constexpr const char* to_c_str_or_empty(enum_type e) noexcept {
+            if ( const std::size_t i = find_value(to_underlying(e)); i != ::enum_hpp::invalid_index ) {
+                return c_names<>[i];
+            }
+            return "";
+        }
+        [[maybe_unused]] static const char* to_c_str_or_throw(enum_type e) {
+            if ( const std::size_t i = find_value(to_underlying(e)); i != ::enum_hpp::invalid_index ) {
+                return c_names<>[i];
+            }
+            ::enum_hpp::detail::throw_exception_with(ENUM_HPP_TRAITS_ERROR(Enum, to_c_str_or_throw));
+        }
+        [[maybe_unused]] static constexpr std::optional<enum_type> from_string(std::string_view name) noexcept {
+            if ( const std::size_t i = find_name(name, ::enum_hpp::detail::hash_name(name)); i != ::enum_hpp::invalid_index ) {
+                return lookup_values[i];
+            }
+            return std::nullopt;
+        }
+        [[maybe_unused]] static constexpr enum_type from_string_or_default(std::string_view name, enum_type def) noexcept {
+            if ( auto e = from_string(name) ) {
+                return *e;
+            }
+            return def;
+        }
+        [[maybe_unused]] static enum_type from_string_or_throw(std::string_view name) {
+            if ( auto e = from_string(name) ) {
+                return *e;
+            }
+            throw_invalid_name();
+        }
+        // the exception of from_string_or_throw or from_string_icase_or_throw
+        template < bool ICase = false >
+        [[noreturn, maybe_unused]] static void throw_invalid_name() {
+            if constexpr ( ICase ) {
+                ::enum_hpp::detail::throw_exception_with(ENUM_HPP_TRAITS_ERROR(Enum, from_string_icase_or_throw));
+            } else {
+                ::enum_hpp::detail::throw_exception_with(ENUM_HPP_TRAITS_ERROR(Enum, from_string_or_throw));
+            }
+        }
+        // there is only the generated hash table, every strategy looks names up there
+        template < ::enum_hpp::lookup_strategy Strategy >
+        [[maybe_unused]] static constexpr std::optional<enum_type> from_string_with(std::string_view name) noexcept {
+            return from_string(name);
+        }
+        [[maybe_unused]] static constexpr ::enum_hpp::parse_result<enum_type> parse_prefix(const char* first, const char* last, std::string_view delimiters = {}) noexcept {
+            const std::string_view input(first, static_cast<std::size_t>(last - first));
+            const std::size_t max_length = input.size() < max_lookup_name_length ? input.size() : max_lookup_name_length;
+
+            std::array<std::uint64_t, max_lookup_name_length + 1> hashes{};
+            hashes[0] = ::enum_hpp::detail::hash_name_basis;
+
+            std::size_t length = 0;
+            while ( length < max_length && delimiters.find(input[length]) == std::string_view::npos ) {
+                hashes[length + 1] = ::enum_hpp::detail::hash_name_step(hashes[length], input[length]);
+                ++length;
+            }
+
+            if ( !delimiters.empty() ) {
+                // only the whole token can match
+                if ( length < input.size() && delimiters.find(input[length]) == std::string_view::npos ) {
+                    return {first, std::nullopt};
+                }
+                if ( const std::size_t i = find_name(input.substr(0, length), hashes[length]); i != ::enum_hpp::invalid_index ) {
+                    return {first + length, lookup_values[i]};
+                }
+                return {first, std::nullopt};
+            }
+
+            for ( ; length > 0; --length ) {
+                if ( const std::size_t i = find_name(input.substr(0, length), hashes[length]); i != ::enum_hpp::invalid_index ) {
+                    return {first + length, lookup_values[i]};
+                }
+            }
+            return {first, std::nullopt};
+        }
+        template < ::enum_hpp::lookup_strategy Strategy >
+        [[maybe_unused]] static constexpr ::enum_hpp::parse_result<enum_type> parse_prefix_with(const char* first, const char* last, std::string_view delimiters = {}) noexcept {
+            return parse_prefix(first, last, delimiters);
+        }
+        [[maybe_unused]] static constexpr std::size_t from_strings(const std::string_view* strings, std::size_t count, enum_type* out, bool* found = nullptr) noexcept {
+            std::size_t misses = 0;
+            for ( std::size_t i = 0; i < count; ++i ) {
+                const std::size_t k = find_name(strings[i], ::enum_hpp::detail::hash_name(strings[i]));
+                if ( k != ::enum_hpp::invalid_index ) {
+                    out[i] = lookup_values[k];
+                } else {
+                    ++misses;
+                }
+                if ( found ) {
+                    found[i] = k != ::enum_hpp::invalid_index;
+                }
+            }
+            return misses;
+        }
+        template < ::enum_hpp::lookup_strategy Strategy >
+        [[maybe_unused]] static constexpr std::size_t from_strings_with(const std::string_view* strings, std::size_t count, enum_type* out, bool* found = nullptr) noexcept {
+            return from_strings(strings, count, out, found);
+        }
+        [[maybe_unused]] static constexpr std::optional<enum_type> from_string_icase(std::string_view name) noexcept {
+            if ( const std::size_t i = find_name_icase(name); i != ::enum_hpp::invalid_index ) {
+                return lookup_values[i];
+            }
+            return std::nullopt;
+        }
+        [[maybe_unused]] static constexpr enum_type from_string_icase_or_default(std::string_view name, enum_type def) noexcept {
+            if ( auto e = from_string_icase(name) ) {
+                return *e;
+            }
+            return def;
+        }
+        [[maybe_unused]] static enum_type from_string_icase_or_throw(std::string_view name) {
+            if ( auto e = from_string_icase(name) ) {
+                return *e;
+            }
+            throw_invalid_name<true>();
+        }
+        template < ::enum_hpp::lookup_strategy Strategy >
+        [[maybe_unused]] static constexpr std::optional<enum_type> from_string_icase_with(std::string_view name) noexcept {
+            return from_string_icase(name);
+        }
+#endif
+        [[maybe_unused]] static constexpr std::optional<enum_type> from_name_hash(std::uint64_t hash) noexcept {
+            for ( std::size_t slot = static_cast<std::size_t>(hash & slot_mask); lookup_slots[slot] != 0; slot = (slot + 1) & slot_mask ) {
+                if ( const std::size_t i = lookup_slots[slot] - 1u; i < size && name_hashes[i] == hash ) {
+                    return values[i];
+                }
+            }
+            return std::nullopt;
+        }
+        [[maybe_unused]] static constexpr enum_type from_name_hash_or_default(std::uint64_t hash, enum_type def) noexcept {
+            if ( auto e = from_name_hash(hash) ) {
+                return *e;
+            }
+            return def;
+        }
+        [[maybe_unused]] static enum_type from_name_hash_or_throw(std::uint64_t hash) {
+            if ( auto e = from_name_hash(hash) ) {
+                return *e;
+            }
+            ::enum_hpp::detail::throw_exception_with(ENUM_HPP_TRAITS_ERROR(Enum, from_name_hash_or_throw));
+        }
+        [[maybe_unused]] static constexpr std::optional<std::size_t> to_index(enum_type e) noexcept {
+            if ( const std::size_t i = find_value(to_underlying(e)); i != ::enum_hpp::invalid_index ) {
+                return i;
+            }
+            return std::nullopt;
+        }
+        [[maybe_unused]] static constexpr std::size_t to_index_or_invalid(enum_type e) noexcept {
+            return find_value(to_underlying(e));
+        }
+        [[maybe_unused]] static std::size_t to_index_or_throw(enum_type e) {
+            if ( auto i = to_index(e) ) {
+                return *i;
+            }
+            ::enum_hpp::detail::throw_exception_with(ENUM_HPP_TRAITS_ERROR(Enum, to_index_or_throw));
+        }
+        [[maybe_unused]] static constexpr std::optional<enum_type> from_index(std::size_t index) noexcept {
+            if ( index < size ) {
+                return values[index];
+            }
+            return std::nullopt;
+        }
+        [[maybe_unused]] static constexpr enum_type from_index_or_default(std::size_t index, enum_type def) noexcept {
+            if ( auto e = from_index(index) ) {
+                return *e;
+            }
+            return def;
+        }
+        [[maybe_unused]] static enum_type from_index_or_throw(std::size_t index) {
+            if ( auto e = from_index(index) ) {
+                return *e;
+            }
+            ::enum_hpp::detail::throw_exception_with(ENUM_HPP_TRAITS_ERROR(Enum, from_index_or_throw));
+        }
+    private:
+#if !defined(ENUM_HPP_NO_NAMES)
+        static constexpr std::size_t find_name(std::string_view name, std::uint64_t hash) noexcept {
+            for ( std::size_t slot = static_cast<std::size_t>(hash & slot_mask); lookup_slots[slot] != 0; slot = (slot + 1) & slot_mask ) {
+                if ( const std::size_t i = lookup_slots[slot] - 1u; lookup_names[i] == name ) {
+                    return i;
+                }
+            }
+            return ::enum_hpp::invalid_index;
+        }
+        static constexpr std::size_t find_name_icase(std::string_view name) noexcept {
+            const ::enum_hpp::detail::ascii_lower_fold fold{};
+            const std::uint64_t hash = ::enum_hpp::detail::hash_name(name, fold);
+            for ( std::size_t slot = static_cast<std::size_t>(hash & slot_mask); icase_lookup_slots[slot] != 0; slot = (slot + 1) & slot_mask ) {
+                const std::size_t i = icase_lookup_slots[slot] - 1u;
+                const std::string_view key = lookup_names[i];
+                bool equal = key.size() == name.size();
+                for ( std::size_t j = 0; equal && j < key.size(); ++j ) {
+                    equal = fold(key[j]) == fold(name[j]);
+                }
+                if ( equal ) {
+                    return i;
+                }
+            }
+            return ::enum_hpp::invalid_index;
+        }
+#endif
+)";
+
+    constexpr std::string_view dense_find_value_text = R"(        static constexpr std::size_t find_value(underlying_type value) noexcept {
+            const auto offset = static_cast<std::make_unsigned_t<underlying_type>>(
+                static_cast<std::make_unsigned_t<underlying_type>>(value) - static_cast<std::make_unsigned_t<underlying_type>>(min_value));
+            if ( offset < values_index.size() && values_index[offset] != 0 ) {
+                return values_index[offset] - 1u;
+            }
+            return ::enum_hpp::invalid_index;
+        }
+)";
+
+    constexpr std::string_view sparse_find_value_text = R"(        static constexpr std::size_t find_value(underlying_type value) noexcept {
+            std::size_t first = 0;
+            std::size_t count = sorted_values.size();
+            while ( count > 0 ) {
+                const std::size_t half = count / 2;
+                if ( sorted_values[first + half] < value ) {
+                    first += half + 1;
+                    count -= half + 1;
+                } else {
+                    count = half;
+                }
+            }
+            if ( first < sorted_values.size() && sorted_values[first] == value ) {
+                return sorted_indices[first];
+            }
+            return ::enum_hpp::invalid_index;
+        }
+)";
+
+    void write_header(std::ostream& out, const description& desc, const tables& t, const std::string& input_name) {
+        const underlying_info& info = desc.info;
+        const std::string traits = desc.name + "_traits";
+        const std::string lookup_index_type = index_type(t.lookup_names.size());
+        const std::string field_index_type = index_type(desc.fields.size());
+
+        const auto value_name = [&desc](std::size_t index){
+            return desc.name + "::" + desc.fields[index].name;
+        };
+
+        std::size_t max_name_length = 0;
+        std::size_t max_lookup_name_length = 0;
+        for ( std::size_t i = 0; i < t.lookup_names.size(); ++i ) {
+            max_lookup_name_length = std::max(max_lookup_name_length, t.lookup_names[i].size());
+            max_name_length = i < desc.fields.size() ? max_lookup_name_length : max_name_length;
+        }
+
+        out << "// generated by enum_gen from " << input_name << ", do not edit\n\n";
+        out << "#pragma once\n\n";
+        out << "#include <enum.hpp/enum_core.hpp>\n";
+        out << "#include <enum.hpp/enum_string.hpp>\n";
+        out << "#include <enum.hpp/enum_throw.hpp>\n\n";
+        out << "#include <array>\n";
+        out << "#include <cstddef>\n";
+        out << "#include <cstdint>\n";
+        out << "#include <optional>\n";
+        out << "#include <string_view>\n";
+        out << "#include <type_traits>\n\n";
+
+        if ( !desc.ns.empty() ) {
+            out << "namespace " << desc.ns << "\n{\n";
+        }
+
+        out << "    enum " << (desc.scoped ? "class " : "") << desc.name << " : " << desc.type << " {\n";
+        for ( const field& f : desc.fields ) {
+            out << "        " << f.name << " = " << value_literal(f.value, info) << ",\n";
+        }
+        out << "    };\n\n";
+
+        out << "    struct " << traits << " final {\n";
+        out << "        using enum_type = " << desc.name << ";\n";
+        out << "        using underlying_type = " << desc.type << ";\n";
+        out << "        static constexpr std::string_view type_name = std::string_view(\"" << desc.name << "\", " << desc.name.size() << ");\n";
+        out << "        static constexpr std::size_t size = " << desc.fields.size() << ";\n\n";
+
+        std::vector<std::size_t> field_indices(desc.fields.size());
+        for ( std::size_t i = 0; i < field_indices.size(); ++i ) {
+            field_indices[i] = i;
+        }
+
+        write_array(out, "enum_type", "values", field_indices, [&](std::size_t i){
+            out << value_name(i);
+        });
+        out << "\n";
+
+        out << "        static constexpr underlying_type min_value = " << value_literal(t.min_value, info) << ";\n";
+        out << "        static constexpr underlying_type max_value = " << value_literal(t.max_value, info) << ";\n";
+        out << "        static constexpr bool is_contiguous = " << (t.is_contiguous ? "true" : "false") << ";\n";
+        out << "        static constexpr bool is_single_bit = " << (t.is_single_bit ? "true" : "false") << ";\n\n";
+
+        write_array(out, "std::uint64_t", "name_hashes", field_indices, [&](std::size_t i){
+            out << hash_literal(t.name_hashes[i]) << " /*" << desc.fields[i].name << "*/";
+        });
+
+        // make_tables rejects colliding names
+        out << "        template < typename = void >\n";
+        out << "        static constexpr bool name_hashes_unique = true;\n\n";
+
+        out << "#if !defined(ENUM_HPP_NO_NAMES)\n";
+        out << "        template < typename = void >\n";
+        write_array(out, "const char*", "c_names", field_indices, [&](std::size_t i){
+            out << "\"" << desc.fields[i].name << "\"";
+        });
+        // views of the NUL-terminated c_names, like the pool of declared traits
+        out << "        template < typename = void >\n";
+        write_array(out, "std::string_view", "names", field_indices, [&](std::size_t i){
+            out << "std::string_view(c_names<>[" << i << "], " << desc.fields[i].name.size() << ")";
+        });
+        out << "        static constexpr std::size_t max_name_length = " << max_name_length << ";\n";
+        out << "        static constexpr ::enum_hpp::lookup_strategy lookup = ::enum_hpp::lookup_strategy::hash_table;\n";
+        out << "#endif\n";
+
+        out << "    private:\n";
+        out << "        // field values, then alias values\n";
+        std::vector<std::size_t> lookup_indices(t.lookup_names.size());
+        for ( std::size_t i = 0; i < lookup_indices.size(); ++i ) {
+            lookup_indices[i] = i;
+        }
+        write_array(out, "enum_type", "lookup_values", lookup_indices, [&](std::size_t i){
+            out << value_name(t.lookup_fields[i]);
+        });
+        out << "#if !defined(ENUM_HPP_NO_NAMES)\n";
+        write_array(out, "std::string_view", "lookup_names", lookup_indices, [&](std::size_t i){
+            out << "std::string_view(\"" << t.lookup_names[i] << "\", " << t.lookup_names[i].size() << ")";
+        });
+        out << "        static constexpr std::size_t max_lookup_name_length = " << max_lookup_name_length << ";\n";
+        out << "#endif\n\n";
+
+        out << "        // open addressing by enum_hpp::hash_name, a lookup index + 1 per slot, 0 for empty slots\n";
+        out << "        static constexpr std::size_t slot_mask = " << t.lookup_slots.size() - 1 << ";\n";
+        write_array(out, lookup_index_type, "lookup_slots", t.lookup_slots, [&](std::size_t slot){
+            out << slot;
+        }, 16);
+        out << "#if !defined(ENUM_HPP_NO_NAMES)\n";
+        out << "        // the same by ASCII lowercase name hashes, the first declared name wins on ambiguity\n";
+        write_array(out, lookup_index_type, "icase_lookup_slots", t.icase_lookup_slots, [&](std::size_t slot){
+            out << slot;
+        }, 16);
+        out << "#endif\n\n";
+
+        if ( !t.values_index.empty() ) {
+            out << "        // a field index + 1 per value in [min_value, max_value], 0 for holes\n";
+            write_array(out, field_index_type, "values_index", t.values_index, [&](std::size_t index){
+                out << index;
+            }, 16);
+        } else {
+            out << "        // the sorted distinct values and the first field index of every value\n";
+            write_array(out, "underlying_type", "sorted_values", t.sorted_values, [&](std::uint64_t value){
+                out << value_literal(value, info);
+            }, 8);
+            write_array(out, field_index_type, "sorted_indices", t.sorted_indices, [&](std::size_t index){
+                out << index;
+            }, 16);
+        }
+
+        std::string functions(functions_text);
+        functions += t.values_index.empty() ? sparse_find_value_text : dense_find_value_text;
+        replace_all(functions, "(Enum, ", "(" + desc.name + ", ");
+        out << functions;
+        out << "    };\n\n";
+
+        out << "    constexpr " << traits << " enum_hpp_adl_find_registered_traits [[maybe_unused]] (" << desc.name << ") noexcept {\n";
+        out << "        return " << traits << "{};\n";
+        out << "    }\n";
+        if ( !desc.ns.empty() ) {
+            out << "}\n";
+        }
+    }
+
+    // keeps the output untouched when nothing is changed, so dependents are not rebuilt
+    bool write_if_changed(const char* path, const std::string& content) {
+        {
+            std::ifstream in(path, std::ios::binary);
+            const std::string old((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+            if ( in && old == content ) {
+                return true;
+            }
+        }
+        std::ofstream out(path, std::ios::binary);
+        out << content;
+        return static_cast<bool>(out);
+    }
+}
+
+int main(int argc, char* argv[]) {
+    if ( argc != 3 ) {
+        std::cerr << "usage: " << argv[0] << " <input> <output>" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::ifstream in(argv[1]);
+    if ( !in ) {
+        std::cerr << argv[1] << ": error: failed to open" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    try {
+        const description desc = parse_description(in);
+        const tables t = make_tables(desc);
+
+        std::ostringstream out;
+        write_header(out, desc, t, std::string_view(argv[1]).substr(std::string_view(argv[1]).find_last_of("/\\") + 1).data());
+
+        if ( !write_if_changed(argv[2], out.str()) ) {
+            std::cerr << argv[2] << ": error: failed to write" << std::endl;
+            return EXIT_FAILURE;
+        }
+    } catch ( const parse_error& e ) {
+        std::cerr << argv[1] << ":" << e.line() << ": error: " << e.what() << std::endl;
+        return EXIT_FAILURE;
+    } catch ( const std::exception& e ) {
+        std::cerr << argv[1] << ": error: " << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
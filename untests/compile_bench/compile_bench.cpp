@@ -0,0 +1,160 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/enum.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2019-2023, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+//
+// compile_bench <enums> <fields> <budget> <source> <reference source>
+//               <preprocess command> <compile command> <reference command>
+//
+// writes <source> with <enums> declarations of <fields> fields each,
+// runs the commands and reports their time and peak memory
+//
+// <reference source> only includes the library, the compile time is reported
+// in units of its compile time and fails the run when it exceeds <budget>,
+// so the budget holds on any machine (0 disables it)
+//
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <optional>
+#include <string>
+
+#if defined(__unix__) || defined(__APPLE__)
+#  include <sys/resource.h>
+#  define ENUM_HPP_COMPILE_BENCH_RUSAGE
+#endif
+
+namespace
+{
+    void write_source(std::ostream& out, std::size_t enums, std::size_t fields) {
+        out << "#include <enum.hpp/enum.hpp>\n\n";
+        out << "#include <string_view>\n\n";
+
+        for ( std::size_t e = 0; e < enums; ++e ) {
+            out << "namespace bench_" << e << "\n{\n";
+            out << "    ENUM_HPP_CLASS_DECL(bench, int,";
+            for ( std::size_t f = 0; f < fields; ++f ) {
+                out << "\n        ";
+                if ( f % 16 == 0 ) {
+                    out << "((field_" << f << " = " << f * 2 << ")(alias_" << f << "))";
+                } else if ( f % 4 == 0 ) {
+                    out << "(field_" << f << " = " << f * 2 << ")";
+                } else {
+                    out << "(field_" << f << ")";
+                }
+            }
+            out << ")\n\n";
+            out << "    ENUM_HPP_REGISTER_TRAITS(bench)\n";
+            out << "}\n\n";
+        }
+
+        // a header declares many enums, a translation unit uses a few of them
+        for ( std::size_t e = 0; e < enums && e < 2; ++e ) {
+            out << "namespace bench_" << e << "\n{\n";
+            out << "    int use(std::string_view name) {\n";
+            out << "        int result = static_cast<int>(enum_hpp::to_string_or_empty(bench::field_1).size());\n";
+            out << "        result += enum_hpp::from_string<bench>(name) ? 1 : 0;\n";
+            out << "        result += enum_hpp::from_string_icase<bench>(name) ? 1 : 0;\n";
+            out << "        return result;\n";
+            out << "    }\n";
+            out << "}\n\n";
+        }
+    }
+
+    // peak resident set size of all finished child processes, in KiB
+    long children_peak_memory() {
+    #if defined(ENUM_HPP_COMPILE_BENCH_RUSAGE)
+        rusage usage{};
+        if ( getrusage(RUSAGE_CHILDREN, &usage) != 0 ) {
+            return -1;
+        }
+    #  if defined(__APPLE__)
+        return usage.ru_maxrss / 1024;
+    #  else
+        return usage.ru_maxrss;
+    #  endif
+    #else
+        return -1;
+    #endif
+    }
+
+    // the best of a few runs, a busy machine only makes single runs slower
+    constexpr int step_runs = 3;
+
+    std::optional<double> run_step(const char* name, const std::string& command) {
+        double best = std::numeric_limits<double>::max();
+        for ( int run = 0; run < step_runs; ++run ) {
+            const auto start = std::chrono::steady_clock::now();
+            const int status = std::system(command.c_str());
+            const auto finish = std::chrono::steady_clock::now();
+
+            if ( status != 0 ) {
+                std::cerr << name << ": failed (" << status << "): " << command << std::endl;
+                return std::nullopt;
+            }
+
+            best = std::min(best, std::chrono::duration<double>(finish - start).count());
+        }
+
+        std::cout << name << ": " << best << " s";
+        if ( const long peak = children_peak_memory(); peak >= 0 ) {
+            std::cout << ", peak memory " << peak / 1024 << " MiB";
+        }
+        std::cout << std::endl;
+        return best;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    if ( argc != 9 ) {
+        std::cerr << "usage: " << argv[0] << " <enums> <fields> <budget> <source> <reference source>"
+            << " <preprocess command> <compile command> <reference command>" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    const std::size_t enums = std::strtoul(argv[1], nullptr, 10);
+    const std::size_t fields = std::strtoul(argv[2], nullptr, 10);
+    const double budget = std::strtod(argv[3], nullptr);
+
+    {
+        std::ofstream source(argv[4]);
+        write_source(source, enums, fields);
+        std::ofstream reference(argv[5]);
+        write_source(reference, 0, 0);
+        if ( !source || !reference ) {
+            std::cerr << "failed to write " << argv[4] << " or " << argv[5] << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+
+    std::cout << enums << " enums x " << fields << " fields" << std::endl;
+
+    // the reference and the preprocessor run first, so the peak memory of the
+    // compile step is the maximum of all and is the compiler one in practice
+    const std::optional<double> reference = run_step("reference", argv[8]);
+    const std::optional<double> preprocess = reference ? run_step("preprocess", argv[6]) : std::nullopt;
+    const std::optional<double> compile = preprocess ? run_step("compile", argv[7]) : std::nullopt;
+    if ( !compile ) {
+        return EXIT_FAILURE;
+    }
+
+    const double relative = *compile / std::max(*reference, 1e-3);
+    std::cout << "compile: " << relative << " x reference";
+    if ( budget > 0.0 ) {
+        std::cout << ", budget " << budget << " x reference";
+    }
+    std::cout << std::endl;
+
+    if ( budget > 0.0 && relative > budget ) {
+        std::cerr << "compile: over budget" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -4,11 +4,13 @@
  * Copyright (C) 2019-2023, by Matvey Cherevko (blackmatov@gmail.com)
  ******************************************************************************/
 
+#include <enum.hpp/enum.hpp>
 #include <enum.hpp/enum_bitflags.hpp>
 
 #include "enum_tests.hpp"
 
 #include <cstdint>
+#include <string>
 #include <type_traits>
 
 namespace
@@ -23,6 +25,15 @@ namespace
     };
 
     ENUM_HPP_OPERATORS_DECL(access)
+
+    ENUM_HPP_CLASS_DECL(perms, unsigned,
+        (read = 1 << 0)
+        (write = 1 << 1)
+        (execute = 1 << 2)
+        (admin = 1u << 31))
+
+    ENUM_HPP_REGISTER_TRAITS(perms)
+    ENUM_HPP_OPERATORS_DECL(perms)
 }
 
 TEST_CASE("enum_bitflags") {
@@ -84,6 +95,75 @@ TEST_CASE("enum_bitflags") {
         CHECK(hasher1(access::read) != hasher2(access::read_write));
     }
 
+    SUBCASE("from_string") {
+        STATIC_CHECK(bf::from_string<perms>("read") == perms::read);
+        STATIC_CHECK(bf::from_string<perms>("read|write") == (perms::read | perms::write));
+        STATIC_CHECK(bf::from_string<perms>(" write | execute ") == (perms::write | perms::execute));
+        STATIC_CHECK(bf::from_string<perms>("read|read") == perms::read);
+        STATIC_CHECK(bf::from_string<perms>("") == bf::bitflags<perms>{});
+        STATIC_CHECK(bf::from_string<perms>("  ") == bf::bitflags<perms>{});
+        STATIC_CHECK(bf::from_string<perms>("read,write", ',') == (perms::read | perms::write));
+        STATIC_CHECK(bf::from_string<perms>("read write", ' ') == (perms::read | perms::write));
+        STATIC_CHECK(bf::from_string<perms>(" read write execute ", ' ') == (perms::read | perms::write | perms::execute));
+        STATIC_CHECK(bf::from_string<perms>("read\twrite", '\t') == (perms::read | perms::write));
+        STATIC_CHECK(bf::from_string<perms>("read \t write", '\t') == (perms::read | perms::write));
+        STATIC_CHECK(bf::from_string<perms>("  ", ' ') == bf::bitflags<perms>{});
+
+        STATIC_CHECK_FALSE(bf::from_string<perms>("read|"));
+        STATIC_CHECK_FALSE(bf::from_string<perms>("read||write"));
+        STATIC_CHECK_FALSE(bf::from_string<perms>("read write"));
+        STATIC_CHECK_FALSE(bf::from_string<perms>("read,write"));
+        STATIC_CHECK_FALSE(bf::from_string<perms>("read  write", ' '));
+        STATIC_CHECK_FALSE(bf::from_string<perms>("read|write", ' '));
+        STATIC_CHECK_FALSE(bf::from_string<perms>("read\t\twrite", '\t'));
+
+        {
+            std::string_view bad_token;
+            CHECK_FALSE(bf::from_string<perms>("read | writ | execute", '|', &bad_token));
+            CHECK(bad_token == "writ");
+        }
+        {
+            std::string_view bad_token;
+            CHECK_FALSE(bf::from_string<perms>("read write|execute", '|', &bad_token));
+            CHECK(bad_token == "read write");
+        }
+        {
+            std::string_view bad_token;
+            CHECK_FALSE(bf::from_string<perms>("read|", '|', &bad_token));
+            CHECK(bad_token.empty());
+        }
+        {
+            std::string_view bad_token = "untouched";
+            CHECK(bf::from_string<perms>("read|execute", '|', &bad_token) == (perms::read | perms::execute));
+            CHECK(bad_token == "untouched");
+        }
+    }
+
+    SUBCASE("to_string") {
+        STATIC_CHECK(enum_hpp::is_single_bit<perms>());
+        STATIC_CHECK_FALSE(enum_hpp::is_contiguous<perms>());
+
+        STATIC_CHECK(enum_hpp::to_string(perms::admin) == "admin");
+        STATIC_CHECK(enum_hpp::to_index(perms::admin) == 3);
+        STATIC_CHECK_FALSE(enum_hpp::to_string(perms(1u << 30)));
+        STATIC_CHECK_FALSE(enum_hpp::to_string(perms(0)));
+        STATIC_CHECK_FALSE(enum_hpp::to_index(perms(3)));
+
+        constexpr unsigned raw_perms[] = {1, 2, 4, 1u << 31, 3};
+        STATIC_CHECK(enum_hpp::validate<perms>(raw_perms, 4) == enum_hpp::invalid_index);
+        STATIC_CHECK(enum_hpp::validate<perms>(raw_perms, 5) == 4);
+        STATIC_CHECK(enum_hpp::from_underlying<perms>(1u << 31) == perms::admin);
+        STATIC_CHECK_FALSE(enum_hpp::from_underlying<perms>(0));
+
+        CHECK(bf::to_string(bf::bitflags<perms>{}) == "");
+        CHECK(bf::to_string(bf::bitflags(perms::write)) == "write");
+        CHECK(bf::to_string(perms::read | perms::execute | perms::admin) == "read|execute|admin");
+        CHECK(bf::to_string(perms::read | perms::write, ',') == "read,write");
+        CHECK_FALSE(bf::to_string(perms::read | perms(1u << 30)));
+
+        CHECK(bf::from_string<perms>(*bf::to_string(perms::write | perms::admin)) == (perms::write | perms::admin));
+    }
+
     SUBCASE("enum_operators") {
         STATIC_CHECK((~access::read) == bf::bitflags<access>(0xFE));
         STATIC_CHECK((access::read | access::write) == bf::bitflags<access>(0x3));
@@ -74,7 +74,7 @@ TEST_CASE("examples") {
         static_assert(color_traits::from_index(42) == std::nullopt);
 
         // names
-        for ( std::string_view n : color_traits::names ) {
+        for ( std::string_view n : color_traits::names<> ) {
             std::cout << n << ",";
         } // stdout: red,green,blue,
     }
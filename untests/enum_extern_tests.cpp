@@ -0,0 +1,74 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/enum.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2019-2023, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#include "enum_extern_tests.hpp"
+
+#include "enum_tests.hpp"
+
+#include <string_view>
+
+namespace some_namespace::externs
+{
+    ENUM_HPP_TRAITS_DEFINE(color)
+    ENUM_HPP_TRAITS_DEFINE(level)
+}
+
+TEST_CASE("enum_extern") {
+    namespace ex = some_namespace::externs;
+    using ex::color;
+    using ex::level;
+    using ex::level_low;
+    using ex::level_high;
+
+    SUBCASE("constexpr_data") {
+        STATIC_CHECK(enum_hpp::size<color>() == 3);
+        STATIC_CHECK(enum_hpp::values<color>()[1] == color::green);
+        STATIC_CHECK(ex::color_traits::names<>[2] == "blue");
+        STATIC_CHECK(ex::color_traits::max_name_length == 5);
+        STATIC_CHECK(enum_hpp::to_underlying(color::blue) == 8u);
+        STATIC_CHECK(enum_hpp::from_index<color>(0) == color::red);
+        STATIC_CHECK(enum_hpp::name_hashes<color>()[0] == enum_hpp::hash_name("red"));
+        STATIC_CHECK_FALSE(ex::level_traits::is_contiguous);
+    }
+
+    SUBCASE("defined_functions") {
+        CHECK(enum_hpp::to_string(color::green) == "green");
+        CHECK_FALSE(enum_hpp::to_string(color(42)));
+        CHECK(enum_hpp::to_string_or_empty(level_high) == "level_high");
+        CHECK(std::string_view(enum_hpp::to_c_str_or_empty(color::red)) == "red");
+
+        CHECK(enum_hpp::from_string<color>("navy") == color::blue);
+        CHECK_FALSE(enum_hpp::from_string<color>("Navy"));
+        CHECK(enum_hpp::from_string_icase<color>("Navy") == color::blue);
+        CHECK(enum_hpp::from_string_or_default<level>("level", level_low) == level_low);
+        CHECK(enum_hpp::from_string_with<color, enum_hpp::lookup_strategy::linear>("red") == color::red);
+
+        CHECK(enum_hpp::from_underlying<color>(3) == color::green);
+        CHECK_FALSE(enum_hpp::from_underlying<color>(4));
+        CHECK(enum_hpp::from_name_hash<color>(enum_hpp::hash_name("blue")) == color::blue);
+        CHECK(enum_hpp::to_index(level_high) == 1u);
+        CHECK(enum_hpp::to_index_or_invalid(level(5)) == enum_hpp::invalid_index);
+
+        const int levels[]{0, 10, 5};
+        CHECK(enum_hpp::validate<level>(levels, 3) == 2u);
+
+        const std::string_view text = "green,red";
+        const auto parsed = ex::color_traits::parse_prefix(text.data(), text.data() + text.size(), ",");
+        CHECK(parsed.value == color::green);
+        CHECK(parsed.ptr == text.data() + 5);
+    }
+
+    SUBCASE("throws") {
+        CHECK(enum_hpp::to_string_or_throw(color::red) == "red");
+        CHECK(enum_hpp::from_string_or_throw<level>("level_low") == level_low);
+    #ifndef ENUM_HPP_NO_EXCEPTIONS
+        CHECK_THROWS_WITH(
+            enum_hpp::to_index_or_throw(color(42)),
+            "color_traits::to_index_or_throw(): invalid argument");
+        CHECK_THROWS_AS(enum_hpp::from_underlying_or_throw<level>(5), enum_hpp::exception);
+    #endif
+    }
+}
@@ -0,0 +1,25 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/enum.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2019-2023, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#pragma once
+
+#include <enum.hpp/enum.hpp>
+
+namespace some_namespace::externs
+{
+    ENUM_HPP_CLASS_DECL_EXTERN(color, unsigned,
+        (red = 2)
+        (green)
+        ((blue = 8)(navy)))
+
+    ENUM_HPP_REGISTER_TRAITS(color)
+
+    ENUM_HPP_DECL_EXTERN(level, int,
+        (level_low)
+        (level_high = 10))
+
+    ENUM_HPP_REGISTER_TRAITS(level)
+}
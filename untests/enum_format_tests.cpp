@@ -0,0 +1,95 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/enum.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2019-2023, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#include <enum.hpp/enum.hpp>
+#include <enum.hpp/enum_format.hpp>
+
+#include "enum_tests.hpp"
+
+#include <array>
+#include <string>
+#include <string_view>
+
+namespace
+{
+    namespace fmt_ns
+    {
+        ENUM_HPP_CLASS_DECL(shade, signed char,
+            (dark = -100)
+            (light = 100))
+
+        ENUM_HPP_REGISTER_TRAITS(shade)
+
+        ENUM_HPP_CLASS_DECL(opts, unsigned char,
+            (quiet = 1 << 0)
+            (verbose = 1 << 1)
+            (colored = 1 << 7))
+
+        ENUM_HPP_REGISTER_TRAITS(opts)
+        ENUM_HPP_OPERATORS_DECL(opts)
+    }
+
+    template < typename T, std::size_t N >
+    std::string_view chars_of(std::array<char, N>& buffer, T value) {
+        const std::to_chars_result result = enum_hpp::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+        CHECK(result.ec == std::errc{});
+        return std::string_view(buffer.data(), static_cast<std::size_t>(result.ptr - buffer.data()));
+    }
+}
+
+TEST_CASE("enum_format") {
+    using fmt_ns::shade;
+    using fmt_ns::opts;
+    namespace bf = enum_hpp::bitflags;
+
+    SUBCASE("max_length") {
+        STATIC_CHECK(enum_hpp::max_name_length<shade>() == 5);
+        STATIC_CHECK(fmt_ns::shade_traits::max_name_length == 5);
+        STATIC_CHECK(enum_hpp::max_chars_length<shade>() == std::string_view("shade(-128)").size());
+        STATIC_CHECK(bf::max_chars_length<opts>() >= std::string_view("quiet|verbose|colored|opts(120)").size());
+    }
+
+    SUBCASE("to_chars") {
+        {
+            std::array<char, 64> buffer{};
+            CHECK(chars_of(buffer, shade::dark) == "dark");
+            CHECK(chars_of(buffer, shade::light) == "light");
+            CHECK(chars_of(buffer, shade(17)) == "shade(17)");
+            CHECK(chars_of(buffer, shade(-128)) == "shade(-128)");
+        }
+        {
+            std::array<char, enum_hpp::max_chars_length<shade>()> buffer{};
+            CHECK(chars_of(buffer, shade(-128)) == "shade(-128)");
+        }
+        {
+            std::array<char, 4> buffer{};
+            const std::to_chars_result result = enum_hpp::to_chars(buffer.data(), buffer.data() + buffer.size(), shade::light);
+            CHECK(result.ec == std::errc::value_too_large);
+            CHECK(result.ptr == buffer.data() + buffer.size());
+        }
+    }
+
+    SUBCASE("bitflags_to_chars") {
+        const auto chars_of_flags = [](bf::bitflags<opts> flags, char separator = '|'){
+            static std::array<char, bf::max_chars_length<opts>()> buffer{};
+            const std::to_chars_result result = bf::to_chars(buffer.data(), buffer.data() + buffer.size(), flags, separator);
+            CHECK(result.ec == std::errc{});
+            return std::string(buffer.data(), static_cast<std::size_t>(result.ptr - buffer.data()));
+        };
+
+        CHECK(chars_of_flags({}) == "");
+        CHECK(chars_of_flags(opts::verbose) == "verbose");
+        CHECK(chars_of_flags(opts::quiet | opts::colored) == "quiet|colored");
+        CHECK(chars_of_flags(opts::quiet | opts::colored, ',') == "quiet,colored");
+        CHECK(chars_of_flags(opts::verbose | opts(8) | opts(16)) == "verbose|opts(24)");
+        CHECK(chars_of_flags(opts(4)) == "opts(4)");
+        CHECK(chars_of_flags(~bf::bitflags<opts>{}) == "quiet|verbose|colored|opts(124)");
+
+        std::array<char, 8> buffer{};
+        const std::to_chars_result result = bf::to_chars(buffer.data(), buffer.data() + buffer.size(), opts::quiet | opts::verbose);
+        CHECK(result.ec == std::errc::value_too_large);
+    }
+}
@@ -0,0 +1,161 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/enum.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2019-2023, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#include <enum.hpp/enum.hpp>
+
+#include <enum_gen_color.hpp>
+#include <enum_gen_status.hpp>
+
+#include "enum_tests.hpp"
+
+#include <string_view>
+
+namespace some_namespace::generated
+{
+    ENUM_HPP_CLASS_DECL(color_twin, unsigned,
+        (red = 2)
+        (green)
+        ((blue = 8)(navy)(Navy))
+        (white = 2))
+
+    ENUM_HPP_REGISTER_TRAITS(color_twin)
+}
+
+template <>
+struct enum_hpp::lookup_policy<some_namespace::generated::status> {
+    static constexpr lookup_strategy value = lookup_strategy::linear;
+};
+
+TEST_CASE("enum_gen") {
+    namespace gen = some_namespace::generated;
+    using gen::color;
+    using gen::color_traits;
+    using gen::color_twin;
+    using gen::color_twin_traits;
+    using gen::status;
+
+    SUBCASE("same_tables") {
+        STATIC_CHECK(color_traits::size == color_twin_traits::size);
+        STATIC_CHECK(color_traits::type_name == "color");
+        STATIC_CHECK(color_traits::min_value == color_twin_traits::min_value);
+        STATIC_CHECK(color_traits::max_value == color_twin_traits::max_value);
+        STATIC_CHECK(color_traits::is_contiguous == color_twin_traits::is_contiguous);
+        STATIC_CHECK(color_traits::is_single_bit == color_twin_traits::is_single_bit);
+        STATIC_CHECK(color_traits::max_name_length == color_twin_traits::max_name_length);
+        STATIC_CHECK(color_traits::name_hashes_unique<> == color_twin_traits::name_hashes_unique<>);
+
+        for ( std::size_t i = 0; i < color_traits::size; ++i ) {
+            CHECK(enum_hpp::to_underlying(color_traits::values[i]) == enum_hpp::to_underlying(color_twin_traits::values[i]));
+            CHECK(color_traits::names<>[i] == color_twin_traits::names<>[i]);
+            CHECK(std::string_view(color_traits::c_names<>[i]) == color_twin_traits::c_names<>[i]);
+            CHECK(color_traits::name_hashes[i] == color_twin_traits::name_hashes[i]);
+        }
+    }
+
+    SUBCASE("to_string") {
+        STATIC_CHECK(enum_hpp::to_string(color::green) == "green");
+        STATIC_CHECK(enum_hpp::to_string(color::white) == "red");
+        STATIC_CHECK_FALSE(enum_hpp::to_string(color(42)));
+        STATIC_CHECK(enum_hpp::to_string_or_empty(gen::status_failed) == "status_failed");
+        STATIC_CHECK(enum_hpp::to_string(gen::status_timeout) == "status_timeout");
+        STATIC_CHECK_FALSE(enum_hpp::to_string(status(1)));
+        STATIC_CHECK(std::string_view(enum_hpp::to_c_str_or_empty(color::blue)) == "blue");
+        STATIC_CHECK(std::string_view(enum_hpp::to_c_str_or_empty(color(42))).empty());
+        CHECK(enum_hpp::to_string_or_throw(gen::status_ok) == "status_ok");
+    #ifndef ENUM_HPP_NO_EXCEPTIONS
+        CHECK_THROWS_WITH(
+            enum_hpp::to_string_or_throw(color(42)),
+            "color_traits::to_string_or_throw(): invalid argument");
+    #endif
+    }
+
+    SUBCASE("from_string") {
+        STATIC_CHECK(enum_hpp::from_string<color>("navy") == color::blue);
+        STATIC_CHECK(enum_hpp::from_string<color>("white") == color::white);
+        STATIC_CHECK_FALSE(enum_hpp::from_string<color>("NAVY"));
+        STATIC_CHECK_FALSE(enum_hpp::from_string<color>(""));
+        STATIC_CHECK(enum_hpp::from_string<status>("status_again") == gen::status_retry);
+        STATIC_CHECK((enum_hpp::from_string_with<color, enum_hpp::lookup_strategy::perfect_hash>("green") == color::green));
+        STATIC_CHECK((enum_hpp::from_string_with<color, enum_hpp::lookup_strategy::trie>("navy") == color::blue));
+        STATIC_CHECK_FALSE((enum_hpp::from_string_with<color, enum_hpp::lookup_strategy::linear>("nav")));
+        STATIC_CHECK(ENUM_HPP_VALUE_OF(color, "blue") == color::blue);
+
+        STATIC_CHECK(enum_hpp::from_string_icase<color>("NAVY") == color::blue);
+        STATIC_CHECK(enum_hpp::from_string_icase<status>("Status_Ok") == gen::status_ok);
+        STATIC_CHECK_FALSE(enum_hpp::from_string_icase<color>("bluee"));
+    #ifndef ENUM_HPP_NO_EXCEPTIONS
+        CHECK_THROWS_AS(enum_hpp::from_string_or_throw<color>("black"), enum_hpp::exception);
+    #endif
+
+        for ( std::string_view name : {"red", "green", "blue", "navy", "Navy", "white", "NAVY", "Red", "black"} ) {
+            CHECK(enum_hpp::to_underlying(enum_hpp::from_string_or_default<color>(name, color(42)))
+                == enum_hpp::to_underlying(enum_hpp::from_string_or_default<color_twin>(name, color_twin(42))));
+            CHECK(enum_hpp::to_underlying(enum_hpp::from_string_icase_or_default<color>(name, color(42)))
+                == enum_hpp::to_underlying(enum_hpp::from_string_icase_or_default<color_twin>(name, color_twin(42))));
+        }
+    }
+
+    SUBCASE("lookup_policy") {
+        STATIC_CHECK(color_traits::lookup == enum_hpp::lookup_strategy::hash_table);
+        STATIC_CHECK(enum_hpp::lookup_strategy_of<color>() == enum_hpp::lookup_strategy::hash_table);
+        STATIC_CHECK(enum_hpp::lookup_strategy_of<status>() == enum_hpp::lookup_strategy::linear);
+        STATIC_CHECK(enum_hpp::from_string<status>("status_again") == gen::status_retry);
+        STATIC_CHECK(enum_hpp::from_string_icase<status>("STATUS_OK") == gen::status_ok);
+        STATIC_CHECK_FALSE(enum_hpp::from_string<status>("status"));
+        CHECK(enum_hpp::from_string_or_throw<status>("status_ok") == gen::status_ok);
+    #ifndef ENUM_HPP_NO_EXCEPTIONS
+        CHECK_THROWS_WITH(
+            enum_hpp::from_string_or_throw<status>("status"),
+            "status_traits::from_string_or_throw(): invalid argument");
+    #endif
+    }
+
+    SUBCASE("parse_prefix") {
+        const std::string_view text = "greenish,navy";
+        const auto greenish = enum_hpp::parse_prefix<color>(text.data(), text.data() + text.size());
+        CHECK(greenish.value == color::green);
+        CHECK(greenish.ptr == text.data() + 5);
+
+        const auto token = enum_hpp::parse_prefix<color>(text.data(), text.data() + text.size(), ",");
+        CHECK_FALSE(token.value);
+        CHECK(token.ptr == text.data());
+
+        const auto navy = enum_hpp::parse_prefix<color>(text.data() + 9, text.data() + text.size(), ",");
+        CHECK(navy.value == color::blue);
+        CHECK(navy.ptr == text.data() + text.size());
+
+        const std::string_view names[]{"status_ok", "unknown", "status_again"};
+        status out[3]{};
+        bool found[3]{};
+        CHECK(enum_hpp::from_strings<status>(names, 3, out, found) == 1u);
+        CHECK((out[0] == gen::status_ok && out[2] == gen::status_retry));
+        CHECK((found[0] && !found[1] && found[2]));
+    }
+
+    SUBCASE("values") {
+        STATIC_CHECK(enum_hpp::to_index(color::blue) == 2u);
+        STATIC_CHECK(enum_hpp::to_index(color::white) == 0u);
+        STATIC_CHECK(enum_hpp::to_index(gen::status_failed) == 0u);
+        STATIC_CHECK(enum_hpp::to_index(gen::status_timeout) == 3u);
+        STATIC_CHECK_FALSE(enum_hpp::to_index(status(-99)));
+        STATIC_CHECK(enum_hpp::from_index<color>(3) == color::white);
+        STATIC_CHECK(enum_hpp::from_underlying<status>(1000) == gen::status_retry);
+        STATIC_CHECK_FALSE(enum_hpp::from_underlying<color>(4));
+        STATIC_CHECK(enum_hpp::min_value<status>() == -100);
+        STATIC_CHECK(enum_hpp::max_value<status>() == 0x7FFFFFFF);
+        STATIC_CHECK(enum_hpp::from_name_hash<status>(enum_hpp::hash_name("status_ok")) == gen::status_ok);
+        STATIC_CHECK_FALSE(enum_hpp::from_name_hash<status>(enum_hpp::hash_name("status_again")));
+
+        const int statuses[]{0, 1000, -100, 7};
+        CHECK(enum_hpp::validate<status>(statuses, 4) == 3u);
+        CHECK(enum_hpp::validate<status>(statuses, 3) == enum_hpp::invalid_index);
+    #ifndef ENUM_HPP_NO_EXCEPTIONS
+        CHECK_THROWS_WITH(
+            enum_hpp::to_index_or_throw(status(7)),
+            "status_traits::to_index_or_throw(): invalid argument");
+    #endif
+    }
+}
@@ -0,0 +1,96 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/enum.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2019-2023, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#include <enum.hpp/enum.hpp>
+
+#include "enum_tests.hpp"
+
+#include <iterator>
+
+//
+// 4096 fields, far over the old 256 field limit of the declaration macros,
+// in a separate translation unit to keep the other tests fast to compile
+//
+
+namespace
+{
+    namespace many
+    {
+    #define NUMBERS_8(p) (p##0)(p##1)(p##2)(p##3)(p##4)(p##5)(p##6)(p##7)
+    #define NUMBERS_64(p) NUMBERS_8(p##0)NUMBERS_8(p##1)NUMBERS_8(p##2)NUMBERS_8(p##3)\
+        NUMBERS_8(p##4)NUMBERS_8(p##5)NUMBERS_8(p##6)NUMBERS_8(p##7)
+    #define NUMBERS_512(p) NUMBERS_64(p##0)NUMBERS_64(p##1)NUMBERS_64(p##2)NUMBERS_64(p##3)\
+        NUMBERS_64(p##4)NUMBERS_64(p##5)NUMBERS_64(p##6)NUMBERS_64(p##7)
+
+        ENUM_HPP_CLASS_DECL(numbers, unsigned,
+            NUMBERS_512(_0)
+            NUMBERS_512(_1)
+            NUMBERS_512(_2)
+            NUMBERS_512(_3)
+            NUMBERS_512(_4)
+            NUMBERS_512(_5)
+            NUMBERS_512(_6)
+            NUMBERS_512(_7))
+
+    #undef NUMBERS_512
+    #undef NUMBERS_64
+    #undef NUMBERS_8
+
+        ENUM_HPP_REGISTER_TRAITS(numbers)
+    }
+
+    namespace many_v
+    {
+    #define NUMBERS_8(p) p##0, p##1, p##2, p##3, p##4, p##5, p##6, p##7
+    #define NUMBERS_64(p) NUMBERS_8(p##0), NUMBERS_8(p##1), NUMBERS_8(p##2), NUMBERS_8(p##3),\
+        NUMBERS_8(p##4), NUMBERS_8(p##5), NUMBERS_8(p##6), NUMBERS_8(p##7)
+    #define NUMBERS_512(p) NUMBERS_64(p##0), NUMBERS_64(p##1), NUMBERS_64(p##2), NUMBERS_64(p##3),\
+        NUMBERS_64(p##4), NUMBERS_64(p##5), NUMBERS_64(p##6), NUMBERS_64(p##7)
+
+        ENUM_HPP_CLASS_DECL_V(numbers, unsigned,
+            NUMBERS_512(_0),
+            NUMBERS_512(_1),
+            NUMBERS_512(_2),
+            NUMBERS_512(_3),
+            NUMBERS_512(_4),
+            NUMBERS_512(_5),
+            NUMBERS_512(_6),
+            NUMBERS_512(_7))
+
+    #undef NUMBERS_512
+    #undef NUMBERS_64
+    #undef NUMBERS_8
+
+        ENUM_HPP_REGISTER_TRAITS(numbers)
+    }
+}
+
+TEST_CASE("enum_many") {
+    SUBCASE("sequence") {
+        using many::numbers;
+        STATIC_CHECK(many::numbers_traits::size == 4096u);
+        STATIC_CHECK(std::size(enum_hpp::names<numbers>()) == 4096u);
+        STATIC_CHECK(std::size(enum_hpp::values<numbers>()) == 4096u);
+
+        STATIC_CHECK(enum_hpp::to_underlying(numbers::_4000) == 2048u);
+        STATIC_CHECK(enum_hpp::to_underlying(numbers::_7777) == 4095u);
+        STATIC_CHECK(enum_hpp::to_index(numbers::_7777) == 4095u);
+        STATIC_CHECK(enum_hpp::to_string(numbers::_0000) == "_0000");
+        STATIC_CHECK(enum_hpp::to_string(numbers::_7777) == "_7777");
+        STATIC_CHECK(enum_hpp::from_string<numbers>("_6543") == numbers::_6543);
+        STATIC_CHECK_FALSE(enum_hpp::from_string<numbers>("_6548"));
+        STATIC_CHECK_FALSE(enum_hpp::from_underlying<numbers>(4096u));
+    }
+
+    SUBCASE("variadic") {
+        using many_v::numbers;
+        STATIC_CHECK(many_v::numbers_traits::size == 4096u);
+        STATIC_CHECK(enum_hpp::to_underlying(numbers::_7777) == 4095u);
+        STATIC_CHECK(enum_hpp::to_string(numbers::_7777) == "_7777");
+        STATIC_CHECK(enum_hpp::from_string<numbers>("_6543") == numbers::_6543);
+        STATIC_CHECK_FALSE(enum_hpp::from_string<numbers>("_6548"));
+    }
+}
@@ -0,0 +1,149 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/enum.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2019-2023, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#include <enum.hpp/enum.hpp>
+#include <enum.hpp/enum_map.hpp>
+
+#include "enum_tests.hpp"
+
+#include <iterator>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    namespace em
+    {
+        ENUM_HPP_CLASS_DECL(color, unsigned,
+            (red = 2)
+            (green)
+            (blue = red + 4))
+
+        ENUM_HPP_REGISTER_TRAITS(color)
+
+        // same_b shares the slot of b
+        ENUM_HPP_CLASS_DECL(twin, unsigned,
+            (a)
+            (b)
+            (same_b = b)
+            (d))
+
+        ENUM_HPP_REGISTER_TRAITS(twin)
+    }
+
+    constexpr int sum_of(const enum_hpp::enum_map<em::color, int>& map) noexcept {
+        int sum = 0;
+        for ( const auto [e, value] : map ) {
+            sum += static_cast<int>(enum_hpp::to_underlying(e)) * value;
+        }
+        return sum;
+    }
+}
+
+TEST_CASE("enum_map") {
+    using em::color;
+    using color_map = enum_hpp::enum_map<color, int>;
+
+    SUBCASE("constexpr") {
+        constexpr color_map map{{color::red, 1}, {color::blue, 3}};
+        STATIC_CHECK(color_map::size() == 3);
+        STATIC_CHECK(map[color::red] == 1);
+        STATIC_CHECK(map[color::green] == 0);
+        STATIC_CHECK(map[color::blue] == 3);
+        STATIC_CHECK(sum_of(map) == 2 * 1 + 6 * 3);
+        STATIC_CHECK(map.find(color(5)) == map.end());
+        STATIC_CHECK((*map.find(color::blue)).second == 3);
+        STATIC_CHECK(color_map(7).as_array()[2] == 7);
+        STATIC_CHECK(map == color_map{{color::blue, 3}, {color::red, 1}});
+        STATIC_CHECK(map != color_map{});
+    }
+
+    SUBCASE("mutation") {
+        enum_hpp::enum_map<color, std::string> map;
+        map[color::green] = "grass";
+        map[color::blue] += "sky";
+        CHECK(map[color::green] == "grass");
+        CHECK(map.as_array()[2] == "sky");
+
+        for ( auto [e, value] : map ) {
+            value += enum_hpp::to_string_or_empty(e);
+        }
+        CHECK(map[color::red] == "red");
+        CHECK(map[color::green] == "grassgreen");
+
+        if ( auto iter = map.find(color::red); iter != map.end() ) {
+            (*iter).second = "ruby";
+        }
+        CHECK(map[color::red] == "ruby");
+
+        enum_hpp::enum_map<color, std::string> other("none");
+        swap(map, other);
+        CHECK(map[color::blue] == "none");
+        CHECK(other[color::blue] == "skyblue");
+
+        other.fill("x");
+        CHECK(other == enum_hpp::enum_map<color, std::string>("x"));
+    }
+
+    SUBCASE("iteration_order") {
+        const color_map map{{color::green, 20}, {color::red, 10}, {color::blue, 30}};
+
+        std::vector<color> keys;
+        std::vector<int> values;
+        for ( color_map::const_iterator iter = map.cbegin(); iter != map.cend(); ++iter ) {
+            keys.push_back((*iter).first);
+            values.push_back((*iter).second);
+        }
+        CHECK(keys == std::vector<color>{color::red, color::green, color::blue});
+        CHECK(values == std::vector<int>{10, 20, 30});
+        STATIC_CHECK(std::is_same_v<
+            std::iterator_traits<color_map::iterator>::iterator_category,
+            std::input_iterator_tag>);
+    }
+
+    SUBCASE("at") {
+        color_map map{{color::green, 20}};
+        STATIC_CHECK(color_map{{color::blue, 30}}.at(color::blue) == 30);
+        map.at(color::red) = 10;
+        CHECK(map.at(color::red) == 10);
+        CHECK(std::as_const(map).at(color::green) == 20);
+    #ifndef ENUM_HPP_NO_EXCEPTIONS
+        CHECK_THROWS_AS(map.at(color(5)), enum_hpp::exception);
+        CHECK_THROWS_WITH(std::as_const(map).at(color(5)), "enum_hpp::enum_map::at(): invalid argument");
+        CHECK_THROWS_AS(color_map({{color::red, 1}, {color(5), 2}}), enum_hpp::exception);
+    #endif
+    }
+
+    SUBCASE("duplicated_values") {
+        using em::twin;
+        using twin_map = enum_hpp::enum_map<twin, int>;
+
+        twin_map map;
+        map[twin::b] = 5;
+        CHECK(map[twin::same_b] == 5);
+
+        std::vector<twin> keys;
+        std::vector<int> values;
+        for ( const auto [e, value] : map ) {
+            keys.push_back(e);
+            values.push_back(value);
+        }
+        CHECK(keys == std::vector<twin>{twin::a, twin::b, twin::d});
+        CHECK(values == std::vector<int>{0, 5, 0});
+
+        STATIC_CHECK(twin_map::size() == 3);
+        STATIC_CHECK(std::size(twin_map{}.as_array()) == 4);
+
+        // the unused slot of same_b is not compared
+        twin_map other = map;
+        other.as_array()[2] = 42;
+        CHECK(other == map);
+        other[twin::same_b] = 6;
+        CHECK(other != map);
+    }
+}
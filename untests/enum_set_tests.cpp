@@ -0,0 +1,132 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/enum.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2019-2023, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#include <enum.hpp/enum.hpp>
+#include <enum.hpp/enum_set.hpp>
+
+#include "enum_tests.hpp"
+
+#include <vector>
+
+namespace
+{
+    namespace es
+    {
+        ENUM_HPP_CLASS_DECL(color, unsigned,
+            (red = 2)
+            (green)
+            (blue = red + 4))
+
+        ENUM_HPP_REGISTER_TRAITS(color)
+
+        // two words, the last one is not full
+        ENUM_HPP_CLASS_DECL_V(number, int,
+            n0, n1, n2, n3, n4, n5, n6, n7, n8, n9,
+            n10, n11, n12, n13, n14, n15, n16, n17, n18, n19,
+            n20, n21, n22, n23, n24, n25, n26, n27, n28, n29,
+            n30, n31, n32, n33, n34, n35, n36, n37, n38, n39,
+            n40, n41, n42, n43, n44, n45, n46, n47, n48, n49,
+            n50, n51, n52, n53, n54, n55, n56, n57, n58, n59,
+            n60, n61, n62, n63, n64, n65, n66, n67, n68, n69)
+
+        ENUM_HPP_REGISTER_TRAITS(number)
+
+        // the index of same_b is never returned by to_index
+        ENUM_HPP_CLASS_DECL(twin, unsigned,
+            (a)
+            (b)
+            (same_b = b)
+            (d))
+
+        ENUM_HPP_REGISTER_TRAITS(twin)
+    }
+
+    template < typename Enum >
+    std::vector<Enum> members_of(const enum_hpp::enum_set<Enum>& set) {
+        return std::vector<Enum>(set.begin(), set.end());
+    }
+}
+
+TEST_CASE("enum_set") {
+    using es::color;
+    using es::number;
+    using color_set = enum_hpp::enum_set<color>;
+    using number_set = enum_hpp::enum_set<number>;
+
+    SUBCASE("constexpr") {
+        constexpr color_set warm{color::red, color::green};
+        STATIC_CHECK(color_set::word_count == 1);
+        STATIC_CHECK(color_set::max_size() == 3);
+        STATIC_CHECK(warm.size() == 2);
+        STATIC_CHECK(warm.contains(color::green));
+        STATIC_CHECK_FALSE(warm.contains(color::blue));
+        STATIC_CHECK_FALSE(warm.contains(color(4)));
+        STATIC_CHECK(warm.as_words()[0] == 0b011u);
+        STATIC_CHECK(color_set::all().as_words()[0] == 0b111u);
+        STATIC_CHECK(~warm == color_set{color::blue});
+        STATIC_CHECK(color_set{}.empty());
+        STATIC_CHECK(color_set{color(5)}.empty());
+        STATIC_CHECK(*color_set{color::blue}.begin() == color::blue);
+    }
+
+    SUBCASE("insert_erase") {
+        color_set set;
+        CHECK(set.insert(color::blue));
+        CHECK_FALSE(set.insert(color::blue));
+        CHECK_FALSE(set.insert(color(42)));
+        CHECK(set.insert(color::red));
+        CHECK(members_of(set) == std::vector<color>{color::red, color::blue});
+        CHECK(set.erase(color::red));
+        CHECK_FALSE(set.erase(color::red));
+        CHECK(set.size() == 1);
+        set.clear();
+        CHECK(set.empty());
+        CHECK(set.begin() == set.end());
+    }
+
+    SUBCASE("word_operations") {
+        constexpr number_set low{number::n0, number::n1, number::n63};
+        constexpr number_set high{number::n63, number::n64, number::n69};
+
+        STATIC_CHECK(number_set::word_count == 2);
+        STATIC_CHECK(number_set::all().size() == 70);
+        STATIC_CHECK(number_set::all().as_words()[1] == 0b111111u);
+        STATIC_CHECK((~number_set{}) == number_set::all());
+        STATIC_CHECK((low | high).size() == 5);
+        STATIC_CHECK((low & high) == number_set{number::n63});
+        STATIC_CHECK((low - high) == number_set{number::n0, number::n1});
+        STATIC_CHECK((low ^ high) == number_set{number::n0, number::n1, number::n64, number::n69});
+        STATIC_CHECK(low.intersects(high));
+        STATIC_CHECK_FALSE((low - high).intersects(high));
+        STATIC_CHECK((low | high).includes(low));
+        STATIC_CHECK_FALSE(low.includes(high));
+
+        CHECK(members_of(low | high) == std::vector<number>{
+            number::n0, number::n1, number::n63, number::n64, number::n69});
+        CHECK(members_of(number_set::all()).size() == 70);
+
+        number_set set = low;
+        set |= high;
+        set -= number_set{number::n1};
+        set &= ~number_set{number::n69};
+        CHECK(members_of(set) == std::vector<number>{number::n0, number::n63, number::n64});
+    }
+
+    SUBCASE("duplicated_values") {
+        using es::twin;
+        using twin_set = enum_hpp::enum_set<twin>;
+
+        STATIC_CHECK(twin_set::max_size() == 3);
+        STATIC_CHECK(twin_set::all().size() == 3);
+        STATIC_CHECK(twin_set::all().as_words()[0] == 0b1011u);
+        STATIC_CHECK((~twin_set{}) == twin_set::all());
+        STATIC_CHECK((~twin_set{twin::same_b}) == twin_set{twin::a, twin::d});
+        STATIC_CHECK(twin_set{twin::same_b} == twin_set{twin::b});
+
+        CHECK(members_of(twin_set::all()) == std::vector<twin>{twin::a, twin::b, twin::d});
+        CHECK(members_of(~twin_set{twin::a}) == std::vector<twin>{twin::b, twin::d});
+    }
+}
@@ -52,8 +52,37 @@ namespace some_namespace
         (_201)(_202)(_203)(_204)(_205)(_206)(_207)(_208)(_209)(_210)(_211)(_212)(_213)(_214)(_215)(_216)(_217)(_218)(_219)(_220)
         (_221)(_222)(_223)(_224)(_225)(_226)(_227)(_228)(_229)(_230)(_231)(_232)(_233)(_234)(_235)(_236)(_237)(_238)(_239)(_240))
 
+#define NUMBERS_8(p) (p##0)(p##1)(p##2)(p##3)(p##4)(p##5)(p##6)(p##7)
+#define NUMBERS_64(p) NUMBERS_8(p##0)NUMBERS_8(p##1)NUMBERS_8(p##2)NUMBERS_8(p##3)\
+    NUMBERS_8(p##4)NUMBERS_8(p##5)NUMBERS_8(p##6)NUMBERS_8(p##7)
+#define NUMBERS_512(p) NUMBERS_64(p##0)NUMBERS_64(p##1)NUMBERS_64(p##2)NUMBERS_64(p##3)\
+    NUMBERS_64(p##4)NUMBERS_64(p##5)NUMBERS_64(p##6)NUMBERS_64(p##7)
+
+    ENUM_HPP_CLASS_DECL(many_numbers, unsigned,
+        NUMBERS_512(_0)
+        NUMBERS_512(_1))
+
+#undef NUMBERS_512
+#undef NUMBERS_64
+#undef NUMBERS_8
+
+    ENUM_HPP_CLASS_DECL(status, int,
+        ((ok)(OK)(success))
+        (warning = 10)
+        ((gray = warning * 2)(grey))
+        ((fail)))
+
+    ENUM_HPP_CLASS_DECL(level, signed char,
+        (low = -128)
+        (middle = 0)
+        (high = 127)
+        (top = high))
+
     ENUM_HPP_REGISTER_TRAITS(some_namespace::color)
+    ENUM_HPP_REGISTER_TRAITS(some_namespace::level)
+    ENUM_HPP_REGISTER_TRAITS(some_namespace::status)
     ENUM_HPP_REGISTER_TRAITS(some_namespace::numbers)
+    ENUM_HPP_REGISTER_TRAITS(some_namespace::many_numbers)
     ENUM_HPP_REGISTER_TRAITS(some_namespace::render::mask)
 
     namespace exns
@@ -71,8 +100,58 @@ namespace some_namespace
 
         ENUM_HPP_REGISTER_TRAITS(external_enum)
     }
+
+    namespace vans
+    {
+        ENUM_HPP_CLASS_DECL_V(color, unsigned,
+            red = 2,
+            green,
+            blue = green + 4,
+            white = red | green | blue | 8)
+
+        ENUM_HPP_DECL_V(level, signed char,
+            low = -128,
+            middle = 0,
+            high = 127,
+            top = high)
+
+        enum class external_enum : unsigned short {
+            a = 10,
+            b,
+            c = a + b
+        };
+
+        ENUM_HPP_TRAITS_DECL_V(external_enum,
+            a = 10,
+            b,
+            c = a + b)
+
+#define NUMBERS_8(p) p##0, p##1, p##2, p##3, p##4, p##5, p##6, p##7
+#define NUMBERS_64(p) NUMBERS_8(p##0), NUMBERS_8(p##1), NUMBERS_8(p##2), NUMBERS_8(p##3),\
+    NUMBERS_8(p##4), NUMBERS_8(p##5), NUMBERS_8(p##6), NUMBERS_8(p##7)
+#define NUMBERS_512(p) NUMBERS_64(p##0), NUMBERS_64(p##1), NUMBERS_64(p##2), NUMBERS_64(p##3),\
+    NUMBERS_64(p##4), NUMBERS_64(p##5), NUMBERS_64(p##6), NUMBERS_64(p##7)
+
+        ENUM_HPP_CLASS_DECL_V(many_numbers, unsigned,
+            NUMBERS_512(_0),
+            NUMBERS_512(_1))
+
+#undef NUMBERS_512
+#undef NUMBERS_64
+#undef NUMBERS_8
+
+        ENUM_HPP_REGISTER_TRAITS(color)
+        ENUM_HPP_REGISTER_TRAITS(level)
+        ENUM_HPP_REGISTER_TRAITS(external_enum)
+        ENUM_HPP_REGISTER_TRAITS(many_numbers)
+    }
 }
 
+template <>
+struct enum_hpp::lookup_policy<some_namespace::status> {
+    static constexpr lookup_strategy value = lookup_strategy::trie;
+};
+
 TEST_CASE("enum") {
     namespace sn = some_namespace;
 
@@ -130,7 +209,7 @@ TEST_CASE("enum") {
     SUBCASE("size") {
         {
             STATIC_CHECK(sn::color_traits::size == 3u);
-            STATIC_CHECK(sn::color_traits::size == std::size(sn::color_traits::names));
+            STATIC_CHECK(sn::color_traits::size == std::size(sn::color_traits::names<>));
             STATIC_CHECK(sn::color_traits::size == std::size(sn::color_traits::values));
 
             STATIC_CHECK(enum_hpp::size<sn::color>() == 3u);
@@ -140,12 +219,12 @@ TEST_CASE("enum") {
         }
         {
             STATIC_CHECK(sn::render::mask_traits::size == 4u);
-            STATIC_CHECK(sn::render::mask_traits::size == std::size(sn::render::mask_traits::names));
+            STATIC_CHECK(sn::render::mask_traits::size == std::size(sn::render::mask_traits::names<>));
             STATIC_CHECK(sn::render::mask_traits::size == std::size(sn::render::mask_traits::values));
         }
         {
             STATIC_CHECK(sn::numbers_traits::size == 241u);
-            STATIC_CHECK(sn::numbers_traits::size == std::size(sn::numbers_traits::names));
+            STATIC_CHECK(sn::numbers_traits::size == std::size(sn::numbers_traits::names<>));
             STATIC_CHECK(sn::numbers_traits::size == std::size(sn::numbers_traits::values));
 
             STATIC_CHECK(enum_hpp::size<sn::numbers>() == 241u);
@@ -158,6 +237,17 @@ TEST_CASE("enum") {
             STATIC_CHECK(std::size(enum_hpp::names<sn::render::mask>()) == 4u);
             STATIC_CHECK(std::size(enum_hpp::values<sn::render::mask>()) == 4u);
         }
+        {
+            STATIC_CHECK(sn::many_numbers_traits::size == 1024u);
+            STATIC_CHECK(std::size(enum_hpp::names<sn::many_numbers>()) == 1024u);
+            STATIC_CHECK(std::size(enum_hpp::values<sn::many_numbers>()) == 1024u);
+
+            STATIC_CHECK(enum_hpp::to_underlying(sn::many_numbers::_1777) == 1023u);
+            STATIC_CHECK(enum_hpp::to_string(sn::many_numbers::_0000) == "_0000");
+            STATIC_CHECK(enum_hpp::to_string(sn::many_numbers::_1777) == "_1777");
+            STATIC_CHECK(enum_hpp::from_string<sn::many_numbers>("_1234") == sn::many_numbers::_1234);
+            STATIC_CHECK_FALSE(enum_hpp::from_string<sn::many_numbers>("_1238"));
+        }
     }
 
     SUBCASE("to_underlying") {
@@ -262,6 +352,68 @@ TEST_CASE("enum") {
         }
     }
 
+    SUBCASE("names_storage") {
+        {
+            // not the stringized "blue = red + 4" declaration
+            for ( std::size_t i = 0; i < sn::color_traits::size; ++i ) {
+                const std::string_view name = enum_hpp::names<sn::color>()[i];
+                CHECK(name.data() == enum_hpp::to_string(sn::color_traits::values[i])->data());
+                CHECK(name.data()[name.size()] == '\0');
+            }
+            STATIC_CHECK(enum_hpp::names<sn::color>()[2] == "blue");
+        }
+        {
+            for ( std::size_t i = 0; i < sn::numbers_traits::size; ++i ) {
+                const std::string_view name = enum_hpp::names<sn::numbers>()[i];
+                CHECK(name.data() == enum_hpp::to_string(sn::numbers_traits::values[i])->data());
+                CHECK(name.data()[name.size()] == '\0');
+            }
+        }
+    }
+
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+    // g++ reports strlen of a constant pointer into the middle of
+    // a constexpr name pool as an overread
+#  pragma GCC diagnostic push
+#  pragma GCC diagnostic ignored "-Wstringop-overread"
+#endif
+    SUBCASE("to_c_str") {
+        {
+            STATIC_CHECK(std::string_view(sn::color_traits::to_c_str(sn::color::red)) == "red");
+            STATIC_CHECK(std::string_view(sn::color_traits::to_c_str(sn::color::blue)) == "blue");
+            STATIC_CHECK(sn::color_traits::to_c_str(sn::color(42)) == nullptr);
+
+            STATIC_CHECK(std::string_view(sn::color_traits::to_c_str_or_empty(sn::color::green)) == "green");
+            STATIC_CHECK(std::string_view(sn::color_traits::to_c_str_or_empty(sn::color(42))).empty());
+            CHECK(std::string_view(sn::color_traits::to_c_str_or_throw(sn::color::blue)) == "blue");
+        #ifndef ENUM_HPP_NO_EXCEPTIONS
+            CHECK_THROWS_AS(sn::color_traits::to_c_str_or_throw(sn::color(42)), enum_hpp::exception);
+        #endif
+
+            STATIC_CHECK(std::string_view(enum_hpp::to_c_str(sn::status::gray)) == "gray");
+            STATIC_CHECK(std::string_view(enum_hpp::to_c_str_or_empty(sn::level::top)) == "high");
+            CHECK(std::string_view(enum_hpp::to_c_str_or_throw(sn::level::low)) == "low");
+        #ifndef ENUM_HPP_NO_EXCEPTIONS
+            CHECK_THROWS_AS(enum_hpp::to_c_str_or_throw(sn::level(1)), enum_hpp::exception);
+        #endif
+        }
+        {
+            for ( std::size_t i = 0; i < sn::numbers_traits::size; ++i ) {
+                CHECK(std::string_view(enum_hpp::c_names<sn::numbers>()[i]) == sn::numbers_traits::names<>[i]);
+                CHECK(sn::numbers_traits::c_names<>[i] == enum_hpp::to_string(sn::numbers_traits::values[i])->data());
+                CHECK(enum_hpp::c_names<sn::numbers>()[i] == enum_hpp::names<sn::numbers>()[i].data());
+            }
+            for ( std::size_t i = 0; i < sn::color_traits::size; ++i ) {
+                CHECK(enum_hpp::c_names<sn::color>()[i] == enum_hpp::names<sn::color>()[i].data());
+                CHECK(enum_hpp::to_c_str(sn::color_traits::values[i]) == enum_hpp::to_string(sn::color_traits::values[i])->data());
+            }
+            STATIC_CHECK(std::string_view(sn::status_traits::c_names<>[3]) == "fail");
+        }
+    }
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+#  pragma GCC diagnostic pop
+#endif
+
     SUBCASE("from_string") {
         {
             STATIC_CHECK(sn::color_traits::from_string("red") == sn::color::red);
@@ -277,6 +429,9 @@ TEST_CASE("enum") {
             CHECK(sn::color_traits::from_string_or_throw("blue") == sn::color::blue);
 
             STATIC_CHECK_FALSE(sn::color_traits::from_string("42"));
+            STATIC_CHECK_FALSE(sn::color_traits::from_string(""));
+            STATIC_CHECK_FALSE(sn::color_traits::from_string("re"));
+            STATIC_CHECK_FALSE(sn::color_traits::from_string("redd"));
             STATIC_CHECK(sn::color_traits::from_string_or_default("42", sn::color::red) == sn::color::red);
         #ifndef ENUM_HPP_NO_EXCEPTIONS
             CHECK_THROWS_AS(sn::color_traits::from_string_or_throw("42"), enum_hpp::exception);
@@ -287,6 +442,9 @@ TEST_CASE("enum") {
             CHECK(enum_hpp::from_string_or_throw<sn::color>("green") == sn::color::green);
         #ifndef ENUM_HPP_NO_EXCEPTIONS
             CHECK_THROWS_AS(enum_hpp::from_string_or_throw<sn::color>("42"), enum_hpp::exception);
+            CHECK_THROWS_WITH(
+                enum_hpp::from_string_or_throw<sn::color>("42"),
+                "color_traits::from_string_or_throw(): invalid argument");
         #endif
         }
         {
@@ -300,6 +458,13 @@ TEST_CASE("enum") {
             STATIC_CHECK(sn::numbers_traits::from_string("_10") == sn::_10);
             STATIC_CHECK(sn::numbers_traits::from_string("_240") == sn::_240);
             STATIC_CHECK_FALSE(sn::numbers_traits::from_string("error"));
+            STATIC_CHECK_FALSE(sn::numbers_traits::from_string("_241"));
+            STATIC_CHECK_FALSE(sn::numbers_traits::from_string("_"));
+            STATIC_CHECK_FALSE(sn::numbers_traits::from_string(""));
+
+            for ( std::size_t i = 0; i < sn::numbers_traits::size; ++i ) {
+                CHECK(sn::numbers_traits::from_string(sn::numbers_traits::names<>[i]) == sn::numbers_traits::values[i]);
+            }
 
             STATIC_CHECK(enum_hpp::from_string<sn::numbers>("_10") == sn::_10);
             STATIC_CHECK(enum_hpp::from_string<sn::numbers>("_240") == sn::_240);
@@ -307,6 +472,387 @@ TEST_CASE("enum") {
         }
     }
 
+    SUBCASE("from_string_with") {
+        using ls = enum_hpp::lookup_strategy;
+        {
+            STATIC_CHECK(sn::color_traits::from_string_with<ls::linear>("green") == sn::color::green);
+            STATIC_CHECK(sn::color_traits::from_string_with<ls::binary_search>("green") == sn::color::green);
+            STATIC_CHECK(sn::color_traits::from_string_with<ls::perfect_hash>("green") == sn::color::green);
+            STATIC_CHECK(sn::color_traits::from_string_with<ls::trie>("green") == sn::color::green);
+            STATIC_CHECK(sn::color_traits::from_string_with<ls::hash_table>("green") == sn::color::green);
+
+            STATIC_CHECK_FALSE(sn::color_traits::from_string_with<ls::linear>("gren"));
+            STATIC_CHECK_FALSE(sn::color_traits::from_string_with<ls::binary_search>("gren"));
+            STATIC_CHECK_FALSE(sn::color_traits::from_string_with<ls::binary_search>("greed"));
+            STATIC_CHECK_FALSE(sn::color_traits::from_string_with<ls::binary_search>(""));
+            STATIC_CHECK_FALSE(sn::color_traits::from_string_with<ls::perfect_hash>("gren"));
+            STATIC_CHECK_FALSE(sn::color_traits::from_string_with<ls::trie>("gren"));
+            STATIC_CHECK_FALSE(sn::color_traits::from_string_with<ls::trie>("greed"));
+            STATIC_CHECK_FALSE(sn::color_traits::from_string_with<ls::trie>("greenish"));
+            STATIC_CHECK_FALSE(sn::color_traits::from_string_with<ls::trie>(""));
+            STATIC_CHECK_FALSE(sn::color_traits::from_string_with<ls::hash_table>("gren"));
+            STATIC_CHECK_FALSE(sn::color_traits::from_string_with<ls::hash_table>(""));
+
+            STATIC_CHECK(enum_hpp::from_string_with<sn::color, ls::trie>("blue") == sn::color::blue);
+            STATIC_CHECK_FALSE(enum_hpp::from_string_with<sn::color, ls::trie>("blu"));
+        }
+        {
+            STATIC_CHECK(sn::render::mask_traits::from_string_with<ls::trie>("none") == sn::render::mask::none);
+            STATIC_CHECK(sn::render::mask_traits::from_string_with<ls::trie>("color") == sn::render::mask::color);
+            STATIC_CHECK(sn::render::mask_traits::from_string_with<ls::trie>("alpha") == sn::render::mask::alpha);
+            STATIC_CHECK(sn::render::mask_traits::from_string_with<ls::trie>("all") == sn::render::mask::all);
+            STATIC_CHECK_FALSE(sn::render::mask_traits::from_string_with<ls::trie>("alp"));
+        }
+        {
+            STATIC_CHECK(sn::numbers_traits::from_string_with<ls::trie>("_10") == sn::_10);
+            STATIC_CHECK(sn::numbers_traits::from_string_with<ls::trie>("_240") == sn::_240);
+            STATIC_CHECK_FALSE(sn::numbers_traits::from_string_with<ls::trie>("_241"));
+            STATIC_CHECK_FALSE(sn::numbers_traits::from_string_with<ls::trie>("_2x0"));
+
+            for ( std::size_t i = 0; i < sn::numbers_traits::size; ++i ) {
+                const std::string_view name = sn::numbers_traits::names<>[i];
+                CHECK(sn::numbers_traits::from_string_with<ls::linear>(name) == sn::numbers_traits::values[i]);
+                CHECK(sn::numbers_traits::from_string_with<ls::binary_search>(name) == sn::numbers_traits::values[i]);
+                CHECK(sn::numbers_traits::from_string_with<ls::perfect_hash>(name) == sn::numbers_traits::values[i]);
+                CHECK(sn::numbers_traits::from_string_with<ls::trie>(name) == sn::numbers_traits::values[i]);
+                CHECK(sn::numbers_traits::from_string_with<ls::hash_table>(name) == sn::numbers_traits::values[i]);
+            }
+        }
+    }
+
+    SUBCASE("lookup_strategy") {
+        using ls = enum_hpp::lookup_strategy;
+        {
+            STATIC_CHECK(sn::color_traits::lookup == ls::linear);
+            STATIC_CHECK(sn::numbers_traits::lookup == ls::perfect_hash);
+            STATIC_CHECK(sn::status_traits::lookup == ls::binary_search);
+
+            STATIC_CHECK(enum_hpp::lookup_strategy_of<sn::color>() == ls::linear);
+            STATIC_CHECK(enum_hpp::lookup_strategy_of<sn::status>() == ls::trie);
+
+            STATIC_CHECK(enum_hpp::lookup_strategy_name(ls::binary_search) == "binary_search");
+            STATIC_CHECK(enum_hpp::lookup_strategy_name(enum_hpp::lookup_strategy_of<sn::status>()) == "trie");
+        }
+        {
+            STATIC_CHECK(enum_hpp::from_string<sn::status>("grey") == sn::status::gray);
+            STATIC_CHECK(enum_hpp::from_string_or_default<sn::status>("gris", sn::status::ok) == sn::status::ok);
+            CHECK(enum_hpp::from_string_or_throw<sn::status>("success") == sn::status::ok);
+        #ifndef ENUM_HPP_NO_EXCEPTIONS
+            CHECK_THROWS_WITH(
+                enum_hpp::from_string_or_throw<sn::status>("gris"),
+                "status_traits::from_string_or_throw(): invalid argument");
+            CHECK_THROWS_WITH(
+                enum_hpp::from_string_icase_or_throw<sn::status>("GRIS"),
+                "status_traits::from_string_icase_or_throw(): invalid argument");
+            CHECK_THROWS_WITH(
+                sn::status_traits::throw_invalid_name(),
+                "status_traits::from_string_or_throw(): invalid argument");
+            CHECK_THROWS_WITH(
+                sn::status_traits::throw_invalid_name<true>(),
+                "status_traits::from_string_icase_or_throw(): invalid argument");
+        #endif
+
+            STATIC_CHECK(enum_hpp::from_string_icase<sn::status>("GREY") == sn::status::gray);
+            STATIC_CHECK(sn::status_traits::from_string_icase_with<ls::binary_search>("Ok") == sn::status::ok);
+            STATIC_CHECK(sn::status_traits::from_string_icase_with<ls::trie>("FAIL") == sn::status::fail);
+            STATIC_CHECK_FALSE(sn::status_traits::from_string_icase_with<ls::binary_search>("FAILS"));
+        }
+    }
+
+    SUBCASE("value_of") {
+        STATIC_CHECK(ENUM_HPP_VALUE_OF(sn::color, "green") == sn::color::green);
+        STATIC_CHECK(ENUM_HPP_VALUE_OF(sn::numbers, "_240") == sn::_240);
+        STATIC_CHECK(ENUM_HPP_VALUE_OF(sn::status, "success") == sn::status::ok);
+        STATIC_CHECK(std::integral_constant<sn::color, ENUM_HPP_VALUE_OF(sn::color, "blue")>::value == sn::color::blue);
+
+    #if defined(__cpp_nontype_template_args) && __cpp_nontype_template_args >= 201911L
+        STATIC_CHECK(enum_hpp::value_of<sn::color, "green"> == sn::color::green);
+        STATIC_CHECK(enum_hpp::value_of<sn::status, "grey"> == sn::status::gray);
+    #endif
+    }
+
+    SUBCASE("parse_prefix") {
+        {
+            constexpr std::string_view input = "green|blue";
+            constexpr const char* first = input.data();
+            constexpr const char* last = input.data() + input.size();
+
+            STATIC_CHECK(sn::color_traits::parse_prefix(first, last, "|").value == sn::color::green);
+            STATIC_CHECK(sn::color_traits::parse_prefix(first, last, "|").ptr == first + 5);
+
+            STATIC_CHECK(sn::color_traits::parse_prefix(first + 6, last, "|").value == sn::color::blue);
+            STATIC_CHECK(sn::color_traits::parse_prefix(first + 6, last, "|").ptr == last);
+
+            STATIC_CHECK_FALSE(sn::color_traits::parse_prefix(first, first + 4, "|").value);
+            STATIC_CHECK(sn::color_traits::parse_prefix(first, first + 4, "|").ptr == first);
+
+            STATIC_CHECK_FALSE(sn::color_traits::parse_prefix(first + 5, last, "|").value);
+            STATIC_CHECK_FALSE(sn::color_traits::parse_prefix(first, last, ",").value);
+            STATIC_CHECK(sn::color_traits::parse_prefix(first, last).value == sn::color::green);
+        }
+        {
+            constexpr std::string_view input = "alphabet";
+            constexpr const char* first = input.data();
+            constexpr const char* last = input.data() + input.size();
+
+            STATIC_CHECK(enum_hpp::parse_prefix<sn::render::mask>(first, last).value == sn::render::mask::alpha);
+            STATIC_CHECK(enum_hpp::parse_prefix<sn::render::mask>(first, last).ptr == first + 5);
+            STATIC_CHECK_FALSE(enum_hpp::parse_prefix<sn::render::mask>(first, first + 4).value);
+            STATIC_CHECK_FALSE(enum_hpp::parse_prefix<sn::render::mask>(first, last, " ").value);
+        }
+        {
+            constexpr std::string_view input = "allow";
+            constexpr const char* first = input.data();
+            constexpr const char* last = input.data() + input.size();
+
+            STATIC_CHECK(enum_hpp::parse_prefix<sn::render::mask>(first, last).value == sn::render::mask::all);
+            STATIC_CHECK(enum_hpp::parse_prefix<sn::render::mask>(first, last).ptr == first + 3);
+        }
+        {
+            constexpr std::string_view input = "_240_24 _2";
+            constexpr const char* first = input.data();
+            constexpr const char* last = input.data() + input.size();
+
+            STATIC_CHECK(enum_hpp::parse_prefix<sn::numbers>(first, last).value == sn::_240);
+            STATIC_CHECK(enum_hpp::parse_prefix<sn::numbers>(first + 4, last).value == sn::_24);
+            STATIC_CHECK(enum_hpp::parse_prefix<sn::numbers>(first + 4, last, " ").value == sn::_24);
+            STATIC_CHECK(enum_hpp::parse_prefix<sn::numbers>(first + 8, last, " ").value == sn::_2);
+            STATIC_CHECK_FALSE(enum_hpp::parse_prefix<sn::numbers>(first, last, " ").value);
+
+            using ls = enum_hpp::lookup_strategy;
+            STATIC_CHECK(sn::numbers_traits::parse_prefix_with<ls::linear>(first, last).value == sn::_240);
+            STATIC_CHECK(sn::numbers_traits::parse_prefix_with<ls::binary_search>(first + 4, last).value == sn::_24);
+            STATIC_CHECK(sn::numbers_traits::parse_prefix_with<ls::trie>(first + 4, last, " ").value == sn::_24);
+            STATIC_CHECK(sn::numbers_traits::parse_prefix_with<ls::hash_table>(first + 8, last, " ").value == sn::_2);
+            STATIC_CHECK_FALSE(sn::numbers_traits::parse_prefix_with<ls::trie>(first, last, " ").value);
+        }
+        {
+            constexpr std::string_view input = "grey|gris";
+            constexpr const char* first = input.data();
+            constexpr const char* last = input.data() + input.size();
+
+            STATIC_CHECK(enum_hpp::parse_prefix<sn::status>(first, last, "|").value == sn::status::gray);
+            STATIC_CHECK(enum_hpp::parse_prefix<sn::status>(first, last, "|").ptr == first + 4);
+            STATIC_CHECK_FALSE(enum_hpp::parse_prefix<sn::status>(first + 5, last, "|").value);
+        }
+    }
+
+    SUBCASE("from_strings") {
+        {
+            constexpr std::string_view strings[] = {"red", "blue", "gray", "green", "", "blue"};
+            sn::color values[std::size(strings)]{};
+            bool found[std::size(strings)]{};
+
+            CHECK(sn::color_traits::from_strings(strings, std::size(strings), values, found) == 2u);
+
+            CHECK((found[0] && values[0] == sn::color::red));
+            CHECK((found[1] && values[1] == sn::color::blue));
+            CHECK_FALSE(found[2]);
+            CHECK((found[3] && values[3] == sn::color::green));
+            CHECK_FALSE(found[4]);
+            CHECK((found[5] && values[5] == sn::color::blue));
+
+            CHECK(enum_hpp::from_strings(strings, 4, values) == 1u);
+            CHECK(enum_hpp::from_strings(strings, 0, values) == 0u);
+        }
+        {
+            sn::numbers values[sn::numbers_traits::size]{};
+            bool found[sn::numbers_traits::size]{};
+
+            CHECK(enum_hpp::from_strings(
+                sn::numbers_traits::names<>.data(),
+                sn::numbers_traits::size,
+                values,
+                found) == 0u);
+
+            for ( std::size_t i = 0; i < sn::numbers_traits::size; ++i ) {
+                CHECK((found[i] && values[i] == sn::numbers_traits::values[i]));
+            }
+
+            using ls = enum_hpp::lookup_strategy;
+            CHECK(sn::numbers_traits::from_strings_with<ls::linear>(sn::numbers_traits::names<>.data(), sn::numbers_traits::size, values) == 0u);
+            CHECK(sn::numbers_traits::from_strings_with<ls::binary_search>(sn::numbers_traits::names<>.data(), sn::numbers_traits::size, values) == 0u);
+            CHECK(sn::numbers_traits::from_strings_with<ls::trie>(sn::numbers_traits::names<>.data(), sn::numbers_traits::size, values) == 0u);
+            CHECK(sn::numbers_traits::from_strings_with<ls::hash_table>(sn::numbers_traits::names<>.data(), sn::numbers_traits::size, values) == 0u);
+        }
+        {
+            constexpr std::string_view strings[] = {"grey", "gris", "success"};
+            sn::status values[std::size(strings)]{};
+            bool found[std::size(strings)]{};
+
+            CHECK(enum_hpp::from_strings(strings, std::size(strings), values, found) == 1u);
+            CHECK((found[0] && values[0] == sn::status::gray));
+            CHECK_FALSE(found[1]);
+            CHECK((found[2] && values[2] == sn::status::ok));
+        }
+    }
+
+    SUBCASE("from_string_icase") {
+        {
+            STATIC_CHECK(sn::color_traits::from_string_icase("red") == sn::color::red);
+            STATIC_CHECK(sn::color_traits::from_string_icase("GREEN") == sn::color::green);
+            STATIC_CHECK(sn::color_traits::from_string_icase("bLuE") == sn::color::blue);
+
+            STATIC_CHECK(sn::color_traits::from_string_icase_or_default("Red", sn::color::green) == sn::color::red);
+            STATIC_CHECK(sn::color_traits::from_string_icase_or_default("GrEeN", sn::color::red) == sn::color::green);
+
+            CHECK(sn::color_traits::from_string_icase_or_throw("RED") == sn::color::red);
+            CHECK(sn::color_traits::from_string_icase_or_throw("Blue") == sn::color::blue);
+
+            STATIC_CHECK_FALSE(sn::color_traits::from_string_icase("REDD"));
+            STATIC_CHECK_FALSE(sn::color_traits::from_string_icase("gr33n"));
+            STATIC_CHECK(sn::color_traits::from_string_icase_or_default("42", sn::color::red) == sn::color::red);
+        #ifndef ENUM_HPP_NO_EXCEPTIONS
+            CHECK_THROWS_AS(sn::color_traits::from_string_icase_or_throw("42"), enum_hpp::exception);
+        #endif
+
+            STATIC_CHECK(enum_hpp::from_string_icase<sn::color>("GREEN") == sn::color::green);
+            STATIC_CHECK(enum_hpp::from_string_icase_or_default("GREEN", sn::color::red) == sn::color::green);
+            CHECK(enum_hpp::from_string_icase_or_throw<sn::color>("GREEN") == sn::color::green);
+        #ifndef ENUM_HPP_NO_EXCEPTIONS
+            CHECK_THROWS_AS(enum_hpp::from_string_icase_or_throw<sn::color>("42"), enum_hpp::exception);
+            CHECK_THROWS_WITH(
+                enum_hpp::from_string_icase_or_throw<sn::color>("42"),
+                "color_traits::from_string_icase_or_throw(): invalid argument");
+        #endif
+        }
+        {
+            STATIC_CHECK(sn::numbers_traits::from_string_icase("_10") == sn::_10);
+            STATIC_CHECK(sn::numbers_traits::from_string_icase("_240") == sn::_240);
+            STATIC_CHECK_FALSE(sn::numbers_traits::from_string_icase("_241"));
+        }
+    }
+
+    SUBCASE("from_name_hash") {
+        {
+            STATIC_CHECK(enum_hpp::hash_name("") == 0xcbf29ce484222325u);
+            STATIC_CHECK(enum_hpp::hash_name("a") == 0xaf63dc4c8601ec8cu);
+            STATIC_CHECK(enum_hpp::hash_name("foobar") == 0x85944171f73967e8u);
+
+            STATIC_CHECK(sn::color_traits::name_hashes[0] == enum_hpp::hash_name("red"));
+            STATIC_CHECK(sn::color_traits::name_hashes[2] == enum_hpp::hash_name("blue"));
+            STATIC_CHECK(enum_hpp::name_hashes<sn::color>()[1] == enum_hpp::hash_name("green"));
+            STATIC_CHECK(sn::color_traits::name_hashes_unique<>);
+            STATIC_CHECK(sn::numbers_traits::name_hashes_unique<>);
+        }
+        {
+            STATIC_CHECK(sn::color_traits::from_name_hash(enum_hpp::hash_name("red")) == sn::color::red);
+            STATIC_CHECK(sn::color_traits::from_name_hash(enum_hpp::hash_name("green")) == sn::color::green);
+            STATIC_CHECK(sn::color_traits::from_name_hash(enum_hpp::hash_name("blue")) == sn::color::blue);
+
+            STATIC_CHECK_FALSE(sn::color_traits::from_name_hash(0));
+            STATIC_CHECK_FALSE(sn::color_traits::from_name_hash(enum_hpp::hash_name("Red")));
+            STATIC_CHECK(sn::color_traits::from_name_hash_or_default(42, sn::color::red) == sn::color::red);
+            CHECK(sn::color_traits::from_name_hash_or_throw(enum_hpp::hash_name("blue")) == sn::color::blue);
+        #ifndef ENUM_HPP_NO_EXCEPTIONS
+            CHECK_THROWS_AS(sn::color_traits::from_name_hash_or_throw(42), enum_hpp::exception);
+        #endif
+
+            STATIC_CHECK(enum_hpp::from_name_hash<sn::color>(enum_hpp::hash_name("green")) == sn::color::green);
+            STATIC_CHECK(enum_hpp::from_name_hash_or_default(42, sn::color::blue) == sn::color::blue);
+            CHECK(enum_hpp::from_name_hash_or_throw<sn::color>(enum_hpp::hash_name("green")) == sn::color::green);
+        #ifndef ENUM_HPP_NO_EXCEPTIONS
+            CHECK_THROWS_AS(enum_hpp::from_name_hash_or_throw<sn::color>(42), enum_hpp::exception);
+        #endif
+        }
+        {
+            for ( std::size_t i = 0; i < sn::numbers_traits::size; ++i ) {
+                CHECK(sn::numbers_traits::from_name_hash(sn::numbers_traits::name_hashes[i]) == sn::numbers_traits::values[i]);
+            }
+            STATIC_CHECK(sn::numbers_traits::from_name_hash(enum_hpp::hash_name("_240")) == sn::_240);
+            STATIC_CHECK_FALSE(sn::numbers_traits::from_name_hash(enum_hpp::hash_name("_241")));
+        }
+    }
+
+    SUBCASE("value_range") {
+        {
+            STATIC_CHECK(sn::color_traits::min_value == 2);
+            STATIC_CHECK(sn::color_traits::max_value == 6);
+            STATIC_CHECK_FALSE(sn::color_traits::is_contiguous);
+
+            STATIC_CHECK(sn::render::mask_traits::min_value == 0);
+            STATIC_CHECK(sn::render::mask_traits::max_value == 3);
+            STATIC_CHECK(sn::render::mask_traits::is_contiguous);
+
+            STATIC_CHECK(enum_hpp::min_value<sn::numbers>() == 0);
+            STATIC_CHECK(enum_hpp::max_value<sn::numbers>() == 240);
+            STATIC_CHECK(enum_hpp::is_contiguous<sn::numbers>());
+
+            STATIC_CHECK_FALSE(sn::color_traits::is_single_bit);
+            STATIC_CHECK_FALSE(sn::render::mask_traits::is_single_bit);
+            STATIC_CHECK_FALSE(enum_hpp::is_single_bit<sn::numbers>());
+
+            STATIC_CHECK(enum_hpp::min_value<sn::level>() == -128);
+            STATIC_CHECK(enum_hpp::max_value<sn::level>() == 127);
+            STATIC_CHECK_FALSE(enum_hpp::is_contiguous<sn::level>());
+        }
+        {
+            STATIC_CHECK(sn::level_traits::to_string(sn::level::low) == "low");
+            STATIC_CHECK(sn::level_traits::to_string(sn::level::middle) == "middle");
+            STATIC_CHECK(sn::level_traits::to_string(sn::level::high) == "high");
+            STATIC_CHECK(sn::level_traits::to_string(sn::level::top) == "high");
+            STATIC_CHECK_FALSE(sn::level_traits::to_string(sn::level(1)));
+            STATIC_CHECK_FALSE(sn::level_traits::to_string(sn::level(-127)));
+
+            STATIC_CHECK(sn::level_traits::to_index(sn::level::low) == 0);
+            STATIC_CHECK(sn::level_traits::to_index(sn::level::top) == 2);
+            STATIC_CHECK_FALSE(sn::level_traits::to_index(sn::level(126)));
+
+            for ( std::size_t i = 0; i < sn::status_traits::size; ++i ) {
+                CHECK(sn::status_traits::to_index(sn::status_traits::values[i]) == i);
+            }
+            STATIC_CHECK_FALSE(sn::status_traits::to_index(sn::status(5)));
+            STATIC_CHECK_FALSE(sn::status_traits::to_index(sn::status(-1)));
+            STATIC_CHECK_FALSE(sn::status_traits::to_index(sn::status(100)));
+        }
+    }
+
+    SUBCASE("from_underlying") {
+        {
+            STATIC_CHECK(sn::color_traits::from_underlying(2) == sn::color::red);
+            STATIC_CHECK(sn::color_traits::from_underlying(6) == sn::color::blue);
+            STATIC_CHECK_FALSE(sn::color_traits::from_underlying(4));
+            STATIC_CHECK_FALSE(sn::color_traits::from_underlying(100500));
+
+            STATIC_CHECK(sn::color_traits::from_underlying_or_default(3, sn::color::red) == sn::color::green);
+            STATIC_CHECK(sn::color_traits::from_underlying_or_default(4, sn::color::red) == sn::color::red);
+            CHECK(sn::color_traits::from_underlying_or_throw(6) == sn::color::blue);
+        #ifndef ENUM_HPP_NO_EXCEPTIONS
+            CHECK_THROWS_AS(sn::color_traits::from_underlying_or_throw(4), enum_hpp::exception);
+        #endif
+
+            STATIC_CHECK(enum_hpp::from_underlying<sn::level>(-128) == sn::level::low);
+            STATIC_CHECK_FALSE(enum_hpp::from_underlying<sn::level>(-127));
+            STATIC_CHECK(enum_hpp::from_underlying_or_default(1, sn::level::middle) == sn::level::middle);
+            CHECK(enum_hpp::from_underlying_or_throw<sn::level>(127) == sn::level::high);
+        #ifndef ENUM_HPP_NO_EXCEPTIONS
+            CHECK_THROWS_AS(enum_hpp::from_underlying_or_throw<sn::level>(1), enum_hpp::exception);
+        #endif
+        }
+        {
+            constexpr unsigned colors[] = {2, 3, 6, 6, 3, 2};
+            STATIC_CHECK(sn::color_traits::validate(colors, std::size(colors)) == enum_hpp::invalid_index);
+            STATIC_CHECK(sn::color_traits::validate(colors, 0) == enum_hpp::invalid_index);
+
+            constexpr unsigned bad_colors[] = {2, 3, 6, 7};
+            STATIC_CHECK(enum_hpp::validate<sn::color>(bad_colors, std::size(bad_colors)) == 3);
+        }
+        {
+            std::array<signed char, 1000> levels{};
+            for ( std::size_t i = 0; i < levels.size(); ++i ) {
+                levels[i] = static_cast<signed char>(i % 2 ? -128 : 127);
+            }
+            CHECK(enum_hpp::validate<sn::level>(levels.data(), levels.size()) == enum_hpp::invalid_index);
+
+            levels[999] = 1;
+            CHECK(enum_hpp::validate<sn::level>(levels.data(), levels.size()) == 999);
+
+            levels[517] = -1;
+            CHECK(enum_hpp::validate<sn::level>(levels.data(), levels.size()) == 517);
+            CHECK(enum_hpp::validate<sn::level>(levels.data(), 517) == enum_hpp::invalid_index);
+        }
+    }
+
     SUBCASE("to_index") {
         {
             STATIC_CHECK(sn::color_traits::to_index(sn::color::red) == 0u);
@@ -424,6 +970,52 @@ TEST_CASE("enum") {
     }
 }
 
+TEST_CASE("aliases") {
+    namespace sn = some_namespace;
+    using ls = enum_hpp::lookup_strategy;
+
+    STATIC_CHECK(enum_to_underlying(sn::status::ok) == 0);
+    STATIC_CHECK(enum_to_underlying(sn::status::warning) == 10);
+    STATIC_CHECK(enum_to_underlying(sn::status::gray) == 20);
+    STATIC_CHECK(enum_to_underlying(sn::status::fail) == 21);
+
+    STATIC_CHECK(enum_hpp::size<sn::status>() == 4u);
+    STATIC_CHECK(enum_hpp::names<sn::status>()[0] == "ok");
+    STATIC_CHECK(enum_hpp::names<sn::status>()[2] == "gray");
+    STATIC_CHECK(enum_hpp::names<sn::status>()[3] == "fail");
+    STATIC_CHECK(enum_hpp::values<sn::status>()[2] == sn::status::gray);
+
+    STATIC_CHECK(enum_hpp::to_string(sn::status::ok) == "ok");
+    STATIC_CHECK(enum_hpp::to_string(sn::status::gray) == "gray");
+    STATIC_CHECK(enum_hpp::to_index(sn::status::gray) == 2u);
+
+    STATIC_CHECK(enum_hpp::from_string<sn::status>("ok") == sn::status::ok);
+    STATIC_CHECK(enum_hpp::from_string<sn::status>("OK") == sn::status::ok);
+    STATIC_CHECK(enum_hpp::from_string<sn::status>("success") == sn::status::ok);
+    STATIC_CHECK(enum_hpp::from_string<sn::status>("gray") == sn::status::gray);
+    STATIC_CHECK(enum_hpp::from_string<sn::status>("grey") == sn::status::gray);
+    STATIC_CHECK(enum_hpp::from_string<sn::status>("fail") == sn::status::fail);
+    STATIC_CHECK_FALSE(enum_hpp::from_string<sn::status>("Ok"));
+    STATIC_CHECK_FALSE(enum_hpp::from_string<sn::status>("gray = warning * 2"));
+
+    STATIC_CHECK(enum_hpp::from_string_with<sn::status, ls::linear>("grey") == sn::status::gray);
+    STATIC_CHECK(enum_hpp::from_string_with<sn::status, ls::trie>("grey") == sn::status::gray);
+    STATIC_CHECK(enum_hpp::from_string_with<sn::status, ls::trie>("success") == sn::status::ok);
+    STATIC_CHECK_FALSE(enum_hpp::from_string_with<sn::status, ls::trie>("greys"));
+
+    STATIC_CHECK(enum_hpp::from_string_icase<sn::status>("Ok") == sn::status::ok);
+    STATIC_CHECK(enum_hpp::from_string_icase<sn::status>("SUCCESS") == sn::status::ok);
+    STATIC_CHECK(enum_hpp::from_string_icase<sn::status>("Grey") == sn::status::gray);
+
+    {
+        constexpr std::string_view input = "grey;ok";
+        constexpr const char* first = input.data();
+        constexpr const char* last = input.data() + input.size();
+        STATIC_CHECK(enum_hpp::parse_prefix<sn::status>(first, last, ";").value == sn::status::gray);
+        STATIC_CHECK(enum_hpp::parse_prefix<sn::status>(first, last, ";").ptr == first + 4);
+    }
+}
+
 TEST_CASE("external_enum") {
     using ee = some_namespace::exns::external_enum;
     STATIC_CHECK(std::is_same_v<enum_hpp::underlying_type<ee>, unsigned short>);
@@ -437,4 +1029,45 @@ TEST_CASE("external_enum") {
 
     STATIC_CHECK(enum_hpp::to_string(ee::c) == "c");
     STATIC_CHECK(enum_hpp::from_string<ee>("b") == ee::b);
+    STATIC_CHECK(enum_hpp::from_string_icase<ee>("B") == ee::b);
+}
+
+TEST_CASE("variadic_decl") {
+    namespace va = some_namespace::vans;
+    {
+        STATIC_CHECK(va::color_traits::size == 4);
+        STATIC_CHECK(va::color_traits::type_name == "color");
+        STATIC_CHECK(enum_hpp::to_underlying(va::color::blue) == 7u);
+        STATIC_CHECK(enum_hpp::to_underlying(va::color::white) == 15u);
+
+        STATIC_CHECK(enum_hpp::names<va::color>()[1] == "green");
+        STATIC_CHECK(enum_hpp::values<va::color>()[1] == va::color::green);
+        STATIC_CHECK(enum_hpp::values<va::color>()[3] == va::color::white);
+
+        STATIC_CHECK(enum_hpp::to_string(va::color::blue) == "blue");
+        STATIC_CHECK(enum_hpp::from_string<va::color>("white") == va::color::white);
+        STATIC_CHECK_FALSE(enum_hpp::from_string<va::color>("black"));
+        STATIC_CHECK(enum_hpp::to_index(va::color::white) == 3u);
+    }
+    {
+        STATIC_CHECK(std::is_same_v<enum_hpp::underlying_type<va::level>, signed char>);
+        STATIC_CHECK(enum_hpp::min_value<va::level>() == -128);
+        STATIC_CHECK(enum_hpp::max_value<va::level>() == 127);
+        STATIC_CHECK(enum_hpp::names<va::level>()[3] == "top");
+        STATIC_CHECK(enum_hpp::to_string(va::top) == "high");
+        STATIC_CHECK(enum_hpp::from_string<va::level>("top") == va::high);
+    }
+    {
+        using ee = va::external_enum;
+        STATIC_CHECK(enum_hpp::values<ee>()[0] == ee::a);
+        STATIC_CHECK(enum_hpp::values<ee>()[2] == ee::c);
+        STATIC_CHECK(enum_hpp::to_string(ee::c) == "c");
+        STATIC_CHECK(enum_hpp::from_string<ee>("b") == ee::b);
+    }
+    {
+        STATIC_CHECK(va::many_numbers_traits::size == 1024u);
+        STATIC_CHECK(enum_hpp::to_underlying(va::many_numbers::_1777) == 1023u);
+        STATIC_CHECK(enum_hpp::to_string(va::many_numbers::_1777) == "_1777");
+        STATIC_CHECK(enum_hpp::from_string<va::many_numbers>("_1234") == va::many_numbers::_1234);
+    }
 }
@@ -0,0 +1,68 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/enum.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2019-2023, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#if defined(ENUM_HPP_UNTESTS_WITH_FMT)
+#  include <fmt/format.h>
+#endif
+
+#include <enum.hpp/enum.hpp>
+#include <enum.hpp/enum_format.hpp>
+
+#include "../enum_tests.hpp"
+
+#include <string>
+
+namespace
+{
+    namespace fmt_ns
+    {
+        ENUM_HPP_CLASS_DECL(shade, signed char,
+            (dark = -100)
+            (light = 100))
+
+        ENUM_HPP_REGISTER_TRAITS(shade)
+
+        ENUM_HPP_CLASS_DECL(opts, unsigned char,
+            (quiet = 1 << 0)
+            (verbose = 1 << 1)
+            (colored = 1 << 7))
+
+        ENUM_HPP_REGISTER_TRAITS(opts)
+        ENUM_HPP_OPERATORS_DECL(opts)
+    }
+}
+
+TEST_CASE("enum_format_cxx20") {
+    using fmt_ns::shade;
+    using fmt_ns::opts;
+    namespace bf = enum_hpp::bitflags;
+
+#if defined(ENUM_HPP_STD_FORMAT)
+    SUBCASE("std_format") {
+        CHECK(std::format("{}", shade::dark) == "dark");
+        CHECK(std::format("{}", shade(17)) == "shade(17)");
+        CHECK(std::format("{}", shade(-128)) == "shade(-128)");
+        CHECK(std::format("[{:>6}]", shade::light) == "[ light]");
+        CHECK(std::format("[{:*<6}]", shade::dark) == "[dark**]");
+        CHECK(std::format("{}", opts::quiet | opts::colored) == "quiet|colored");
+        CHECK(std::format("{}", opts::verbose | opts(8)) == "verbose|opts(8)");
+        CHECK(std::format("{}", bf::bitflags<opts>{}) == "");
+    }
+#endif
+
+#if defined(ENUM_HPP_UNTESTS_WITH_FMT)
+    SUBCASE("fmt_format") {
+        CHECK(fmt::format("{}", shade::dark) == "dark");
+        CHECK(fmt::format("{}", shade(17)) == "shade(17)");
+        CHECK(fmt::format("{}", shade(-128)) == "shade(-128)");
+        CHECK(fmt::format("[{:>6}]", shade::light) == "[ light]");
+        CHECK(fmt::format("[{:*<6}]", shade::dark) == "[dark**]");
+        CHECK(fmt::format("{}", opts::quiet | opts::colored) == "quiet|colored");
+        CHECK(fmt::format("{}", opts::verbose | opts(8)) == "verbose|opts(8)");
+        CHECK(fmt::format("{}", bf::bitflags<opts>{}) == "");
+    }
+#endif
+}
@@ -0,0 +1,122 @@
+/*******************************************************************************
+ * This file is part of the "https://github.com/blackmatov/enum.hpp"
+ * For conditions of distribution and use, see copyright notice in LICENSE.md
+ * Copyright (C) 2019-2023, by Matvey Cherevko (blackmatov@gmail.com)
+ ******************************************************************************/
+
+#include <enum.hpp/enum.hpp>
+#include <enum.hpp/enum_bitflags.hpp>
+
+#include "../enum_tests.hpp"
+
+#include <array>
+#include <string>
+#include <string_view>
+
+namespace
+{
+    namespace nn
+    {
+        ENUM_HPP_CLASS_DECL(color, unsigned,
+            (red = 2)
+            (green)
+            ((blue = 8)(navy)))
+
+        ENUM_HPP_REGISTER_TRAITS(color)
+
+        ENUM_HPP_CLASS_DECL_V(opts, unsigned char,
+            quiet = 1 << 0,
+            verbose = 1 << 1)
+
+        ENUM_HPP_REGISTER_TRAITS(opts)
+        ENUM_HPP_OPERATORS_DECL(opts)
+    }
+
+    template < typename Traits, typename = void >
+    struct has_names : std::false_type {};
+
+    template < typename Traits >
+    struct has_names<Traits, std::void_t<decltype(Traits::template names<>)>> : std::true_type {};
+
+    template < typename F >
+    std::string chars_of(F write) {
+        std::array<char, 64> buffer{};
+        const std::to_chars_result result = write(buffer.data(), buffer.data() + buffer.size());
+        CHECK(result.ec == std::errc{});
+        return std::string(buffer.data(), static_cast<std::size_t>(result.ptr - buffer.data()));
+    }
+}
+
+TEST_CASE("enum_no_names") {
+    using nn::color;
+    using nn::opts;
+    namespace bf = enum_hpp::bitflags;
+
+    SUBCASE("numeric_tables") {
+        STATIC_CHECK_FALSE(has_names<nn::color_traits>::value);
+        STATIC_CHECK(enum_hpp::size<color>() == 3);
+        STATIC_CHECK(enum_hpp::values<color>()[1] == color::green);
+        STATIC_CHECK(enum_hpp::to_index(color::blue) == 2u);
+        STATIC_CHECK(enum_hpp::from_index<color>(0) == color::red);
+        STATIC_CHECK(enum_hpp::from_underlying<color>(3) == color::green);
+        STATIC_CHECK_FALSE(enum_hpp::from_underlying<color>(4));
+        STATIC_CHECK(nn::opts_traits::size == 2);
+    }
+
+    SUBCASE("name_hashes") {
+        STATIC_CHECK(enum_hpp::name_hashes<color>()[0] == enum_hpp::hash_name("red"));
+        STATIC_CHECK(enum_hpp::to_string(color::green) == enum_hpp::hash_name("green"));
+        STATIC_CHECK(enum_hpp::to_string(opts::verbose) == enum_hpp::hash_name("verbose"));
+        STATIC_CHECK_FALSE(enum_hpp::to_string(color(42)));
+        STATIC_CHECK(enum_hpp::from_name_hash<color>(enum_hpp::hash_name("blue")) == color::blue);
+        STATIC_CHECK_FALSE(enum_hpp::from_name_hash<color>(enum_hpp::hash_name("navy")));
+
+        CHECK(enum_hpp::to_string_or_throw(color::red) == enum_hpp::hash_name("red"));
+    #ifndef ENUM_HPP_NO_EXCEPTIONS
+        CHECK_THROWS_AS(enum_hpp::to_string_or_throw(color(42)), enum_hpp::exception);
+        CHECK_THROWS_WITH(enum_hpp::from_index_or_throw<color>(3), "enum_hpp::from_index_or_throw(): invalid argument");
+    #endif
+    }
+
+    SUBCASE("to_chars") {
+        const auto token_of = [](std::string_view name){
+            return chars_of([name](char* first, char* last){
+                return enum_hpp::detail::write_name(first, last, enum_hpp::hash_name(name));
+            });
+        };
+
+        CHECK(token_of("") == "#cbf29ce484222325");
+        CHECK(token_of("red").size() == enum_hpp::max_chars_length<color>());
+
+        CHECK(chars_of([](char* first, char* last){
+            return enum_hpp::to_chars(first, last, color::red);
+        }) == token_of("red"));
+
+        CHECK(chars_of([](char* first, char* last){
+            return enum_hpp::to_chars(first, last, color(42));
+        }) == "42");
+
+        CHECK(chars_of([](char* first, char* last){
+            return bf::to_chars(first, last, opts::quiet | opts::verbose | opts(8));
+        }) == token_of("quiet") + "|" + token_of("verbose") + "|8");
+
+        CHECK(bf::max_chars_length<opts>() >= (token_of("quiet") + "|" + token_of("verbose") + "|255").size());
+    }
+
+    SUBCASE("bitflags") {
+        const auto token_of = [](std::string_view name){
+            return chars_of([name](char* first, char* last){
+                return enum_hpp::detail::write_name(first, last, enum_hpp::hash_name(name));
+            });
+        };
+
+        STATIC_CHECK((opts::quiet | opts::verbose).has(opts::verbose));
+        STATIC_CHECK(bf::any_of(opts::quiet | opts::verbose, opts::quiet));
+
+        CHECK(bf::to_string(bf::bitflags<opts>{}) == "");
+        CHECK(bf::to_string(bf::bitflags(opts::verbose)) == token_of("verbose"));
+        CHECK(bf::to_string(opts::quiet | opts::verbose) == token_of("quiet") + "|" + token_of("verbose"));
+        CHECK(bf::to_string(opts::quiet | opts::verbose, ',') == token_of("quiet") + "," + token_of("verbose"));
+        CHECK_FALSE(bf::to_string(opts::quiet | opts(8)));
+    }
+}